@@ -0,0 +1,722 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of the arena allocator.  An arena allocates memory by
+ *	advancing a pointer within large blocks, and releases all of it at once.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_ARENA_H_
+#define _CL_ARENA_H_
+
+
+#include <complib/cl_types.h>
+#include <complib/cl_memory.h>
+
+
+/****h* Component Library/Arena
+* NAME
+*	Arena
+*
+* DESCRIPTION
+*	The Arena provides fast allocation of many small, short-lived objects
+*	that are all released together, such as the records copied while
+*	parsing a query result.
+*
+*	Memory is allocated by advancing a pointer within a block.  When a block
+*	is full, a new block is chained to the arena.  Individual allocations
+*	can not be freed.  Instead, the arena is reset, either completely or
+*	back to a previously recorded mark, in constant time per block.
+*
+*	Blocks are allocated with cl_malloc.  When memory tracking is enabled,
+*	they are tracked under the file name and line number where the arena
+*	was initialized, so arena usage is reported by cl_mem_display.
+*
+*	The arena is not thread safe.
+*
+*	The Arena functions operate on a cl_arena_t structure which should be
+*	treated as opaque and should be manipulated only through the provided
+*	functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_arena_t, cl_arena_mark_t
+*
+*	Initialization/Destruction:
+*		cl_arena_construct, cl_arena_init, cl_arena_destroy
+*
+*	Allocation:
+*		cl_arena_alloc, cl_arena_zalloc, cl_arena_alloc_align
+*
+*	Reset:
+*		cl_arena_mark, cl_arena_reset_to_mark, cl_arena_reset
+*
+*	Attributes:
+*		cl_arena_bytes_used
+*********/
+
+
+/****d* Component Library: Arena/CL_ARENA_DEF_ALIGN
+* NAME
+*	CL_ARENA_DEF_ALIGN
+*
+* DESCRIPTION
+*	Alignment of allocations made with cl_arena_alloc and cl_arena_zalloc.
+*
+* SYNOPSIS
+*/
+#define CL_ARENA_DEF_ALIGN		(2 * sizeof(void*))
+/*
+* SEE ALSO
+*	Arena, cl_arena_alloc, cl_arena_alloc_align
+*********/
+
+
+/****i* Component Library: Arena/cl_arena_block_t
+* NAME
+*	cl_arena_block_t
+*
+* DESCRIPTION
+*	Header of a block of memory owned by an arena.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_arena_block
+{
+	struct _cl_arena_block	*p_next;
+	size_t					size;
+
+} cl_arena_block_t;
+/*
+* FIELDS
+*	p_next
+*		Next block in the arena, or NULL for the last block.
+*
+*	size
+*		Size of the block, including this header.
+*
+* SEE ALSO
+*	Arena
+*********/
+
+
+/****s* Component Library: Arena/cl_arena_t
+* NAME
+*	cl_arena_t
+*
+* DESCRIPTION
+*	Arena structure.
+*
+*	The cl_arena_t structure should be treated as opaque and should be
+*	manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_arena
+{
+	uint8_t					*p_cur;
+	uint8_t					*p_end;
+	cl_arena_block_t		*p_block;
+	cl_arena_block_t		*p_first;
+	size_t					block_size;
+	size_t					bytes_used;
+	const char				*p_file_name;
+	int32_t					line_num;
+	cl_state_t				state;
+
+} cl_arena_t;
+/*
+* FIELDS
+*	p_cur
+*		Next free byte in the current block.
+*
+*	p_end
+*		End of the current block.
+*
+*	p_block
+*		Block from which memory is currently allocated.
+*
+*	p_first
+*		First block of the arena.  Blocks are chained in the order in which
+*		they were allocated.
+*
+*	block_size
+*		Size of blocks allocated by the arena.  Allocations larger than a
+*		block get a block of their own.
+*
+*	bytes_used
+*		Number of bytes allocated from the arena since it was last reset,
+*		excluding alignment padding.
+*
+*	p_file_name, line_num
+*		Location where the arena was initialized, used to track blocks when
+*		memory tracking is enabled.
+*
+*	state
+*		State of the arena.
+*
+* NOTES
+*	Blocks after the current block are blocks kept by a reset.  They are
+*	reused before new blocks are allocated.
+*
+* SEE ALSO
+*	Arena
+*********/
+
+
+/****s* Component Library: Arena/cl_arena_mark_t
+* NAME
+*	cl_arena_mark_t
+*
+* DESCRIPTION
+*	Position in an arena, recorded by cl_arena_mark.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_arena_mark
+{
+	cl_arena_block_t		*p_block;
+	uint8_t					*p_cur;
+	size_t					bytes_used;
+
+} cl_arena_mark_t;
+/*
+* FIELDS
+*	p_block
+*		Current block when the mark was recorded.
+*
+*	p_cur
+*		Next free byte when the mark was recorded.
+*
+*	bytes_used
+*		Number of bytes used when the mark was recorded.
+*
+* SEE ALSO
+*	Arena, cl_arena_mark, cl_arena_reset_to_mark
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif	/* __cplusplus */
+
+
+/****f* Component Library: Arena/cl_arena_construct
+* NAME
+*	cl_arena_construct
+*
+* DESCRIPTION
+*	The cl_arena_construct function constructs an arena.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_arena_construct(
+	IN	cl_arena_t* const	p_arena );
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_arena_init and cl_arena_destroy.
+*
+*	Calling cl_arena_construct is a prerequisite to calling any other
+*	arena function except cl_arena_init.
+*
+* SEE ALSO
+*	Arena, cl_arena_init, cl_arena_destroy
+*********/
+
+
+/****i* Component Library: Arena/__cl_arena_init_trk
+* NAME
+*	__cl_arena_init_trk
+*
+* DESCRIPTION
+*	The __cl_arena_init_trk function initializes an arena whose blocks are
+*	tracked under the specified location.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+__cl_arena_init_trk(
+	IN	cl_arena_t* const	p_arena,
+	IN	const size_t		block_size,
+	IN	const char* const	p_file_name,
+	IN	const int32_t		line_num );
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure to initialize.
+*
+*	block_size
+*		[in] Size of blocks allocated by the arena.
+*
+*	p_file_name
+*		[in] Name of the source file initializing the arena, or NULL if
+*		blocks should not be tracked.
+*
+*	line_num
+*		[in] Line number in the source file initializing the arena.
+*
+* RETURN VALUES
+*	Same as cl_arena_init.
+*
+* NOTES
+*	Clients should not call __cl_arena_init_trk directly, and should
+*	instead use the cl_arena_init macro.
+*
+* SEE ALSO
+*	Arena, cl_arena_init
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_init
+* NAME
+*	cl_arena_init
+*
+* DESCRIPTION
+*	The cl_arena_init function initializes an arena for use.
+*
+* SYNOPSIS
+*/
+cl_status_t
+cl_arena_init(
+	IN	cl_arena_t* const	p_arena,
+	IN	const size_t		block_size );
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure to initialize.
+*
+*	block_size
+*		[in] Size, in bytes, of blocks allocated by the arena.  The first
+*		block is allocated by cl_arena_init.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the arena was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to allocate the
+*	first block.
+*
+* NOTES
+*	cl_arena_init is a macro.  When memory tracking is enabled, blocks of
+*	the arena are reported by cl_mem_display with the file name and line
+*	number of the call to cl_arena_init.
+*
+* SEE ALSO
+*	Arena, cl_arena_construct, cl_arena_destroy
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_destroy
+* NAME
+*	cl_arena_destroy
+*
+* DESCRIPTION
+*	The cl_arena_destroy function destroys an arena, freeing all of its
+*	blocks.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_arena_destroy(
+	IN	cl_arena_t* const	p_arena );
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	All memory allocated from the arena becomes invalid.
+*
+*	This function should only be called after a call to cl_arena_construct
+*	or cl_arena_init.
+*
+* SEE ALSO
+*	Arena, cl_arena_construct, cl_arena_init
+*********/
+
+
+/****i* Component Library: Arena/__cl_arena_alloc_block
+* NAME
+*	__cl_arena_alloc_block
+*
+* DESCRIPTION
+*	The __cl_arena_alloc_block function allocates from a new or reused block
+*	when the current block of an arena can not satisfy a request.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+__cl_arena_alloc_block(
+	IN	cl_arena_t* const	p_arena,
+	IN	const size_t		size,
+	IN	const size_t		align );
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure.
+*
+*	size
+*		[in] Size of the requested allocation.
+*
+*	align
+*		[in] Alignment of the requested allocation.
+*
+* RETURN VALUES
+*	Pointer to allocated memory if successful.
+*
+*	NULL otherwise.
+*
+* NOTES
+*	Clients should not call __cl_arena_alloc_block directly.
+*
+* SEE ALSO
+*	Arena, cl_arena_alloc_align
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_alloc_align
+* NAME
+*	cl_arena_alloc_align
+*
+* DESCRIPTION
+*	The cl_arena_alloc_align function allocates memory with the specified
+*	alignment from an arena.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_arena_alloc_align(
+	IN	cl_arena_t* const	p_arena,
+	IN	const size_t		size,
+	IN	const size_t		align )
+{
+	uint8_t		*p_mem;
+
+	CL_ASSERT( p_arena );
+	CL_ASSERT( p_arena->state == CL_INITIALIZED );
+	/* The alignment must be a power of two. */
+	CL_ASSERT( align && !(align & (align - 1)) );
+
+	p_mem = (uint8_t*)
+		(((uintn_t)p_arena->p_cur + align - 1) & ~((uintn_t)align - 1));
+	if( p_mem > p_arena->p_end || size > (size_t)(p_arena->p_end - p_mem) )
+		return( __cl_arena_alloc_block( p_arena, size, align ) );
+
+	p_arena->p_cur = p_mem + size;
+	p_arena->bytes_used += size;
+	return( p_mem );
+}
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure from which to allocate.
+*
+*	size
+*		[in] Size of the requested allocation.
+*
+*	align
+*		[in] Alignment of the requested allocation.  Must be a power of two.
+*
+* RETURN VALUES
+*	Pointer to allocated memory if successful.
+*
+*	NULL otherwise.
+*
+* NOTES
+*	The memory remains valid until the arena is reset past it or destroyed.
+*
+* SEE ALSO
+*	Arena, cl_arena_alloc, cl_arena_zalloc
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_alloc
+* NAME
+*	cl_arena_alloc
+*
+* DESCRIPTION
+*	The cl_arena_alloc function allocates memory from an arena.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_arena_alloc(
+	IN	cl_arena_t* const	p_arena,
+	IN	const size_t		size )
+{
+	return( cl_arena_alloc_align( p_arena, size, CL_ARENA_DEF_ALIGN ) );
+}
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure from which to allocate.
+*
+*	size
+*		[in] Size of the requested allocation.
+*
+* RETURN VALUES
+*	Pointer to allocated memory if successful.
+*
+*	NULL otherwise.
+*
+* NOTES
+*	The memory is aligned on CL_ARENA_DEF_ALIGN.
+*
+* SEE ALSO
+*	Arena, cl_arena_alloc_align, cl_arena_zalloc, CL_ARENA_DEF_ALIGN
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_zalloc
+* NAME
+*	cl_arena_zalloc
+*
+* DESCRIPTION
+*	The cl_arena_zalloc function allocates memory initialized to zero from
+*	an arena.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_arena_zalloc(
+	IN	cl_arena_t* const	p_arena,
+	IN	const size_t		size )
+{
+	void	*p_mem;
+
+	p_mem = cl_arena_alloc_align( p_arena, size, CL_ARENA_DEF_ALIGN );
+	if( p_mem )
+		cl_memclr( p_mem, size );
+	return( p_mem );
+}
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure from which to allocate.
+*
+*	size
+*		[in] Size of the requested allocation.
+*
+* RETURN VALUES
+*	Pointer to allocated memory if successful.
+*
+*	NULL otherwise.
+*
+* SEE ALSO
+*	Arena, cl_arena_alloc
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_mark
+* NAME
+*	cl_arena_mark
+*
+* DESCRIPTION
+*	The cl_arena_mark function records the current position in an arena.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_arena_mark(
+	IN	const cl_arena_t* const	p_arena,
+	OUT	cl_arena_mark_t* const	p_mark )
+{
+	CL_ASSERT( p_arena );
+	CL_ASSERT( p_arena->state == CL_INITIALIZED );
+	CL_ASSERT( p_mark );
+
+	p_mark->p_block = p_arena->p_block;
+	p_mark->p_cur = p_arena->p_cur;
+	p_mark->bytes_used = p_arena->bytes_used;
+}
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure.
+*
+*	p_mark
+*		[out] Receives the current position.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Marks nest: a parse records a mark before allocating, and resets to it
+*	when done, releasing its allocations but none made before the mark.
+*
+* SEE ALSO
+*	Arena, cl_arena_reset_to_mark
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_reset_to_mark
+* NAME
+*	cl_arena_reset_to_mark
+*
+* DESCRIPTION
+*	The cl_arena_reset_to_mark function releases all memory allocated from
+*	an arena since a mark was recorded.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_arena_reset_to_mark(
+	IN	cl_arena_t* const			p_arena,
+	IN	const cl_arena_mark_t* const	p_mark )
+{
+	CL_ASSERT( p_arena );
+	CL_ASSERT( p_arena->state == CL_INITIALIZED );
+	CL_ASSERT( p_mark );
+
+	p_arena->p_block = p_mark->p_block;
+	p_arena->p_cur = p_mark->p_cur;
+	p_arena->p_end = (uint8_t*)p_mark->p_block + p_mark->p_block->size;
+	p_arena->bytes_used = p_mark->bytes_used;
+}
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure.
+*
+*	p_mark
+*		[in] Mark recorded by a previous call to cl_arena_mark.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Blocks allocated after the mark are kept and reused by later
+*	allocations.  The mark must not be older than the last call to
+*	cl_arena_reset, nor than any mark already reset to.
+*
+* SEE ALSO
+*	Arena, cl_arena_mark, cl_arena_reset
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_reset
+* NAME
+*	cl_arena_reset
+*
+* DESCRIPTION
+*	The cl_arena_reset function releases all memory allocated from an arena.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_arena_reset(
+	IN	cl_arena_t* const	p_arena,
+	IN	const boolean_t		keep_blocks );
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure.
+*
+*	keep_blocks
+*		[in] TRUE to keep all blocks for reuse.  FALSE to free all blocks
+*		but the first.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	All memory allocated from the arena becomes invalid.
+*
+* SEE ALSO
+*	Arena, cl_arena_reset_to_mark, cl_arena_destroy
+*********/
+
+
+/****f* Component Library: Arena/cl_arena_bytes_used
+* NAME
+*	cl_arena_bytes_used
+*
+* DESCRIPTION
+*	The cl_arena_bytes_used function returns the number of bytes allocated
+*	from an arena.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_arena_bytes_used(
+	IN	const cl_arena_t* const	p_arena )
+{
+	CL_ASSERT( p_arena );
+	CL_ASSERT( p_arena->state == CL_INITIALIZED );
+
+	return( p_arena->bytes_used );
+}
+/*
+* PARAMETERS
+*	p_arena
+*		[in] Pointer to a cl_arena_t structure.
+*
+* RETURN VALUE
+*	Number of bytes allocated since the arena was initialized or last
+*	reset, excluding alignment padding and block headers.
+*
+* SEE ALSO
+*	Arena
+*********/
+
+
+#if defined( CL_TRACK_MEM )
+
+#define cl_arena_init( p_arena, block_size )	\
+	__cl_arena_init_trk( p_arena, block_size, __FILE__, __LINE__ )
+
+#else	/* !defined( CL_TRACK_MEM ) */
+
+#define cl_arena_init( p_arena, block_size )	\
+	__cl_arena_init_trk( p_arena, block_size, NULL, 0 )
+
+#endif	/* defined( CL_TRACK_MEM ) */
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif	/* __cplusplus */
+
+
+#endif	/* _CL_ARENA_H_ */
@@ -59,6 +59,9 @@
 *
 *	The threads in the asynchronous processor wait for callbacks to be queued.
 *
+*	Queued items are submitted as tasks to the work-stealing workers of the
+*	thread pool, so threads do not contend on a shared queue.
+*
 *	The asynchronous processor functions operate on a cl_async_proc_t structure
 *	which should be treated as opaque and manipulated only through the provided
 *	functions.
@@ -90,25 +93,16 @@
 typedef struct _cl_async_proc
 {
 	cl_thread_pool_t	thread_pool;
-	cl_qlist_t			item_queue;
-	cl_spinlock_t		lock;
 	cl_state_t			state;
 
 } cl_async_proc_t;
 /*
 * FIELDS
-*	item_pool
-*		Pool of items storing the callback function and contexts to be invoked
-*		by the asynchronous processor's threads.
-*
 *	thread_pool
 *		Thread pool that will invoke the callbacks.
 *
-*	item_queue
-*		Queue of items that the threads should process.
-*
-*	lock
-*		Lock used to synchronize access to the item pool and queue.
+*	state
+*		State of the asynchronous processor.
 *
 * SEE ALSO
 *	Asynchronous Processor
@@ -165,18 +159,22 @@ typedef struct _cl_async_proc_item
 {
 	cl_pool_item_t			pool_item;
 	cl_pfn_async_proc_cb_t	pfn_callback;
+	cl_thread_pool_task_t	task;
 
 } cl_async_proc_item_t;
 /*
 * FIELDS
 *	pool_item
-*		Pool item for queuing the item to be invoked by the asynchronous
-*		processor's threads.  This field is defined as a pool item to
-*		allow items to be managed by a pool.
+*		Pool item allowing items to be managed by a pool.  It is not used
+*		while the item is queued.
 *
 *	pfn_callback
 *		Pointer to a callback function to invoke when the item is dequeued.
 *
+*	task
+*		Thread pool task used to queue the item.  Set by
+*		cl_async_proc_queue.
+*
 * SEE ALSO
 *	Asynchronous Processor, cl_async_proc_queue, cl_pfn_async_proc_cb_t
 *********/
@@ -329,6 +327,13 @@ cl_async_proc_queue(
 * RETURN VALUES
 *	This function does not return a value.
 *
+* NOTES
+*	The item is submitted to the thread pool with cl_thread_pool_submit,
+*	which queues it to the tail of a worker's inbox and never to a
+*	work-stealing deque.  An asynchronous processor with a single thread
+*	therefore invokes callbacks in the order they were queued.  With
+*	several threads, callbacks run concurrently and in no particular order.
+*
 * SEE ALSO
 *	Asynchronous Processor, cl_async_proc_init, cl_pfn_async_proc_cb_t
 *********/
@@ -53,7 +53,169 @@
 *
 * DESCRIPTION
 *	The Atomic Operations functions allow callers to operate on
-*	32-bit signed integers in an atomic fashion.
+*	32-bit and 64-bit signed integers and on pointers in an atomic fashion.
+*
+*	cl_atomic_tagged_comp_xchg additionally operates on a pointer paired
+*	with a generation tag, for building lock-free structures that are not
+*	subject to the ABA problem.  cl_atomic128_comp_xchg exchanges any
+*	128-bit value on platforms that support it.
+*
+*	Operations are sequentially consistent.  Each has an _ex variant taking
+*	a cl_mem_order_t, which allows weaker orderings on processors where
+*	they are cheaper.
+*
+* SEE ALSO
+*	Types:
+*		atomic32_t, atomic64_t, cl_tagged_ptr_t, cl_atomic128_t,
+*		cl_mem_order_t
+*
+*	32-bit:
+*		cl_atomic_inc, cl_atomic_dec, cl_atomic_add, cl_atomic_sub,
+*		cl_atomic_xchg, cl_atomic_comp_xchg, cl_atomic_fetch_or,
+*		cl_atomic_fetch_and, cl_atomic_fetch_xor, cl_atomic_load,
+*		cl_atomic_store
+*
+*	64-bit:
+*		cl_atomic64_inc, cl_atomic64_dec, cl_atomic64_add, cl_atomic64_sub,
+*		cl_atomic64_xchg, cl_atomic64_comp_xchg, cl_atomic64_fetch_or,
+*		cl_atomic64_fetch_and, cl_atomic64_fetch_xor, cl_atomic64_load,
+*		cl_atomic64_store
+*
+*	Pointers:
+*		cl_atomic_ptr_xchg, cl_atomic_ptr_comp_xchg, cl_atomic_ptr_load,
+*		cl_atomic_ptr_store, cl_atomic_tagged_comp_xchg
+*
+*	128-bit:
+*		cl_atomic128_comp_xchg
+*********/
+
+
+/****s* Component Library: Atomic Operations/cl_tagged_ptr_t
+* NAME
+*	cl_tagged_ptr_t
+*
+* DESCRIPTION
+*	Pointer paired with a generation tag, updated together by
+*	cl_atomic_tagged_comp_xchg.
+*
+* SYNOPSIS
+*	typedef struct _cl_tagged_ptr
+*	{
+*		void* volatile		p_ptr;
+*		volatile uintn_t	tag;
+*
+*	} cl_tagged_ptr_t;
+*
+* FIELDS
+*	p_ptr
+*		Pointer value.
+*
+*	tag
+*		Generation tag, incremented by every successful exchange.
+*
+* NOTES
+*	The structure is defined by the operating system specific headers and
+*	is aligned on twice the size of a pointer, so that it can be exchanged
+*	with a single double width compare and exchange instruction.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_tagged_comp_xchg
+*********/
+
+
+/****d* Component Library: Atomic Operations/atomic64_t
+* NAME
+*	atomic64_t
+*
+* DESCRIPTION
+*	64-bit signed integer operated on by the cl_atomic64 functions.
+*
+* SYNOPSIS
+*	typedef __declspec(align(8)) volatile int64_t	atomic64_t;
+*
+* NOTES
+*	The type is aligned on 8 bytes even on 32-bit platforms, as required
+*	for 64-bit interlocked operations to be atomic.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic64_add, cl_atomic64_load
+*********/
+
+
+/****s* Component Library: Atomic Operations/cl_atomic128_t
+* NAME
+*	cl_atomic128_t
+*
+* DESCRIPTION
+*	128-bit value operated on by cl_atomic128_comp_xchg.
+*
+* SYNOPSIS
+*	typedef __declspec(align(16)) struct _cl_atomic128
+*	{
+*		volatile int64_t	low;
+*		volatile int64_t	high;
+*
+*	} cl_atomic128_t;
+*
+* FIELDS
+*	low
+*		Low order 64 bits.
+*
+*	high
+*		High order 64 bits.
+*
+* NOTES
+*	Only defined when CL_ATOMIC128 is defined, which is the case on 64-bit
+*	platforms.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic128_comp_xchg
+*********/
+
+
+/****d* Component Library: Atomic Operations/cl_mem_order_t
+* NAME
+*	cl_mem_order_t
+*
+* DESCRIPTION
+*	Memory ordering requested from the _ex atomic functions.
+*
+* SYNOPSIS
+*	typedef enum _cl_mem_order
+*	{
+*		CL_MEM_ORDER_RELAXED,
+*		CL_MEM_ORDER_ACQUIRE,
+*		CL_MEM_ORDER_RELEASE,
+*		CL_MEM_ORDER_SEQ_CST
+*
+*	} cl_mem_order_t;
+*
+* VALUES
+*	CL_MEM_ORDER_RELAXED
+*		The operation is atomic but does not order other memory accesses.
+*		Suited to statistics counters.
+*
+*	CL_MEM_ORDER_ACQUIRE
+*		Memory accesses that follow the operation cannot be performed
+*		before it.  Used when taking a lock or reading a published pointer.
+*
+*	CL_MEM_ORDER_RELEASE
+*		Memory accesses that precede the operation cannot be performed
+*		after it.  Used when releasing a lock or publishing a pointer.
+*
+*	CL_MEM_ORDER_SEQ_CST
+*		Full barrier, as used by the functions without the _ex suffix.
+*
+* NOTES
+*	Interlocked operations are full barriers on x86 and x64, where every
+*	ordering performs the same.  Weaker orderings only save barriers on
+*	ARM processors, and on plain loads and stores.
+*
+*	The ordering should be a constant, so that the compiler can drop the
+*	code for the other orderings.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_inc_ex, cl_atomic_load, cl_atomic_store
 *********/
 
 
@@ -290,6 +452,1003 @@ cl_atomic_comp_xchg(
 *********/
 
 
+/****f* Component Library: Atomic Operations/cl_atomic_inc_ex
+* NAME
+*	cl_atomic_inc_ex
+*
+* DESCRIPTION
+*	The _ex variants of the 32-bit atomic operations perform the same
+*	operation as the function without the suffix, with the specified memory
+*	ordering.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int32_t CL_API
+cl_atomic_inc_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const cl_mem_order_t	order );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_dec_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const cl_mem_order_t	order );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_add_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			increment,
+	IN	const cl_mem_order_t	order );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_sub_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			decrement,
+	IN	const cl_mem_order_t	order );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_xchg_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			new_value,
+	IN	const cl_mem_order_t	order );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_comp_xchg_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			compare,
+	IN	const int32_t			new_value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value, increment, decrement, compare, new_value
+*		[in] Same as for the function without the _ex suffix.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Same as for the function without the _ex suffix.
+*
+* NOTES
+*	The functions without the suffix are sequentially consistent.
+*
+* SEE ALSO
+*	Atomic Operations, cl_mem_order_t, cl_atomic_inc, cl_atomic_dec,
+*	cl_atomic_add, cl_atomic_sub, cl_atomic_xchg, cl_atomic_comp_xchg
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_fetch_or
+* NAME
+*	cl_atomic_fetch_or
+*
+* DESCRIPTION
+*	The cl_atomic_fetch_or function atomically combines a 32-bit integer
+*	with a mask using a bitwise OR, and returns the initial value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int32_t CL_API
+cl_atomic_fetch_or(
+	IN	atomic32_t* const	p_value,
+	IN	const int32_t		mask );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_fetch_or_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			mask,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 32-bit integer to modify.
+*
+*	mask
+*		[in] Bits to combine with the value pointed to by p_value.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by p_value.
+*
+* NOTES
+*	Returning the initial value lets callers tell which of the mask bits
+*	they changed, for instance to claim a flag.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_fetch_or, cl_atomic_fetch_and,
+*	cl_atomic_fetch_xor
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_fetch_and
+* NAME
+*	cl_atomic_fetch_and
+*
+* DESCRIPTION
+*	The cl_atomic_fetch_and function atomically combines a 32-bit integer
+*	with a mask using a bitwise AND, and returns the initial value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int32_t CL_API
+cl_atomic_fetch_and(
+	IN	atomic32_t* const	p_value,
+	IN	const int32_t		mask );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_fetch_and_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			mask,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 32-bit integer to modify.
+*
+*	mask
+*		[in] Bits to combine with the value pointed to by p_value.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by p_value.
+*
+* NOTES
+*	Returning the initial value lets callers tell which of the mask bits
+*	they changed, for instance to claim a flag.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_fetch_or, cl_atomic_fetch_and,
+*	cl_atomic_fetch_xor
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_fetch_xor
+* NAME
+*	cl_atomic_fetch_xor
+*
+* DESCRIPTION
+*	The cl_atomic_fetch_xor function atomically combines a 32-bit integer
+*	with a mask using a bitwise exclusive OR, and returns the initial
+*	value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int32_t CL_API
+cl_atomic_fetch_xor(
+	IN	atomic32_t* const	p_value,
+	IN	const int32_t		mask );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_fetch_xor_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			mask,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 32-bit integer to modify.
+*
+*	mask
+*		[in] Bits to combine with the value pointed to by p_value.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by p_value.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_fetch_or, cl_atomic_fetch_and,
+*	cl_atomic_fetch_xor
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_load
+* NAME
+*	cl_atomic_load
+*
+* DESCRIPTION
+*	The cl_atomic_load function reads a 32-bit integer atomically.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int32_t CL_API
+cl_atomic_load(
+	IN	const atomic32_t* const	p_value );
+
+CL_EXPORT int32_t CL_API
+cl_atomic_load_ex(
+	IN	const atomic32_t* const	p_value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to the 32-bit integer to read.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the value pointed to by p_value.
+*
+* NOTES
+*	A relaxed load is a plain read.  An acquire load keeps later accesses
+*	from moving before it.  CL_MEM_ORDER_RELEASE is not meaningful for a
+*	load and behaves as CL_MEM_ORDER_SEQ_CST.
+*
+* SEE ALSO
+*	Atomic Operations, cl_mem_order_t, cl_atomic_store
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_store
+* NAME
+*	cl_atomic_store
+*
+* DESCRIPTION
+*	The cl_atomic_store function writes a 32-bit integer atomically.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_atomic_store(
+	IN	atomic32_t* const	p_value,
+	IN	const int32_t		value );
+
+CL_EXPORT void CL_API
+cl_atomic_store_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to the 32-bit integer to write.
+*
+*	value
+*		[in] Value to write.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	A relaxed store is a plain write.  A release store keeps earlier
+*	accesses from moving after it, and pairs with an acquire load of the
+*	same integer.  Sequentially consistent stores use an exchange.
+*	CL_MEM_ORDER_ACQUIRE is not meaningful for a store and behaves as
+*	CL_MEM_ORDER_SEQ_CST.
+*
+* SEE ALSO
+*	Atomic Operations, cl_mem_order_t, cl_atomic_load
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_inc
+* NAME
+*	cl_atomic64_inc
+*
+* DESCRIPTION
+*	The cl_atomic64_inc function atomically increments a 64-bit signed
+*	integer and returns the incremented value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_inc(
+	IN	atomic64_t* const	p_value );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_inc_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer to increment.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the incremented value pointed to by p_value.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_inc, cl_atomic64_add, cl_atomic64_sub
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_dec
+* NAME
+*	cl_atomic64_dec
+*
+* DESCRIPTION
+*	The cl_atomic64_dec function atomically decrements a 64-bit signed
+*	integer and returns the decremented value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_dec(
+	IN	atomic64_t* const	p_value );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_dec_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer to decrement.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the decremented value pointed to by p_value.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_dec, cl_atomic64_add, cl_atomic64_sub
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_add
+* NAME
+*	cl_atomic64_add
+*
+* DESCRIPTION
+*	The cl_atomic64_add function atomically adds a value to a 64-bit signed
+*	integer and returns the resulting value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_add(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		increment );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_add_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			increment,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer.
+*
+*	increment
+*		[in] Value to add.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the value pointed to by p_value after the operation.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_add, cl_atomic64_inc, cl_atomic64_dec
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_sub
+* NAME
+*	cl_atomic64_sub
+*
+* DESCRIPTION
+*	The cl_atomic64_sub function atomically subtracts a value from a 64-bit
+*	signed integer and returns the resulting value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_sub(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		decrement );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_sub_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			decrement,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer.
+*
+*	decrement
+*		[in] Value to subtract.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the value pointed to by p_value after the operation.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_sub, cl_atomic64_inc, cl_atomic64_dec
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_xchg
+* NAME
+*	cl_atomic64_xchg
+*
+* DESCRIPTION
+*	The cl_atomic64_xchg function atomically sets a 64-bit signed integer
+*	to a new value and returns its initial value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_xchg(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		new_value );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_xchg_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			new_value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer to exchange with new_value.
+*
+*	new_value
+*		[in] Value to assign.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by p_value.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_xchg, cl_atomic64_comp_xchg
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_comp_xchg
+* NAME
+*	cl_atomic64_comp_xchg
+*
+* DESCRIPTION
+*	The cl_atomic64_comp_xchg function atomically compares a 64-bit signed
+*	integer to a desired value, sets that integer to the specified value if
+*	equal, and returns the initial value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_comp_xchg(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		compare,
+	IN	const int64_t		new_value );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_comp_xchg_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			compare,
+	IN	const int64_t			new_value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer to exchange with new_value.
+*
+*	compare
+*		[in] Value to compare to the value pointed to by p_value.
+*
+*	new_value
+*		[in] Value to assign if the value pointed to by p_value is equal to
+*		compare.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by p_value.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_comp_xchg, cl_atomic64_xchg
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_fetch_or
+* NAME
+*	cl_atomic64_fetch_or
+*
+* DESCRIPTION
+*	The cl_atomic64_fetch_or function atomically combines a 64-bit integer
+*	with a mask using a bitwise OR, and returns the initial value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_fetch_or(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		mask );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_fetch_or_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			mask,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer to modify.
+*
+*	mask
+*		[in] Bits to combine with the value pointed to by p_value.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by p_value.
+*
+* NOTES
+*	Returning the initial value lets callers tell which of the mask bits
+*	they changed, for instance to claim a flag.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic64_fetch_or, cl_atomic64_fetch_and,
+*	cl_atomic64_fetch_xor
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_fetch_and
+* NAME
+*	cl_atomic64_fetch_and
+*
+* DESCRIPTION
+*	The cl_atomic64_fetch_and function atomically combines a 64-bit integer
+*	with a mask using a bitwise AND, and returns the initial value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_fetch_and(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		mask );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_fetch_and_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			mask,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer to modify.
+*
+*	mask
+*		[in] Bits to combine with the value pointed to by p_value.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by p_value.
+*
+* NOTES
+*	Returning the initial value lets callers tell which of the mask bits
+*	they changed, for instance to claim a flag.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic64_fetch_or, cl_atomic64_fetch_and,
+*	cl_atomic64_fetch_xor
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_fetch_xor
+* NAME
+*	cl_atomic64_fetch_xor
+*
+* DESCRIPTION
+*	The cl_atomic64_fetch_xor function atomically combines a 64-bit integer
+*	with a mask using a bitwise exclusive OR, and returns the initial
+*	value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_fetch_xor(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		mask );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_fetch_xor_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			mask,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to a 64-bit integer to modify.
+*
+*	mask
+*		[in] Bits to combine with the value pointed to by p_value.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by p_value.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic64_fetch_or, cl_atomic64_fetch_and,
+*	cl_atomic64_fetch_xor
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_load
+* NAME
+*	cl_atomic64_load
+*
+* DESCRIPTION
+*	The cl_atomic64_load function reads a 64-bit integer atomically.
+*
+* SYNOPSIS
+*/
+CL_EXPORT int64_t CL_API
+cl_atomic64_load(
+	IN	const atomic64_t* const	p_value );
+
+CL_EXPORT int64_t CL_API
+cl_atomic64_load_ex(
+	IN	const atomic64_t* const	p_value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to the 64-bit integer to read.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the value pointed to by p_value.
+*
+* NOTES
+*	A relaxed load is a plain read.  An acquire load keeps later accesses
+*	from moving before it.  CL_MEM_ORDER_RELEASE is not meaningful for a
+*	load and behaves as CL_MEM_ORDER_SEQ_CST.
+*
+*	On 32-bit processors, the value is read with a 64-bit compare and
+*	exchange, which is a full barrier whatever the ordering.
+*
+* SEE ALSO
+*	Atomic Operations, cl_mem_order_t, cl_atomic64_store
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic64_store
+* NAME
+*	cl_atomic64_store
+*
+* DESCRIPTION
+*	The cl_atomic64_store function writes a 64-bit integer atomically.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_atomic64_store(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		value );
+
+CL_EXPORT void CL_API
+cl_atomic64_store_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			value,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	p_value
+*		[in] Pointer to the 64-bit integer to write.
+*
+*	value
+*		[in] Value to write.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	A relaxed store is a plain write.  A release store keeps earlier
+*	accesses from moving after it, and pairs with an acquire load of the
+*	same integer.  Sequentially consistent stores use an exchange.
+*	CL_MEM_ORDER_ACQUIRE is not meaningful for a store and behaves as
+*	CL_MEM_ORDER_SEQ_CST.
+*
+*	On 32-bit processors, the value is always written with an exchange.
+*
+* SEE ALSO
+*	Atomic Operations, cl_mem_order_t, cl_atomic64_load
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_ptr_xchg
+* NAME
+*	cl_atomic_ptr_xchg
+*
+* DESCRIPTION
+*	The cl_atomic_ptr_xchg function atomically sets a pointer to a new
+*	value and returns its initial value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+cl_atomic_ptr_xchg(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_new );
+
+CL_EXPORT void* CL_API
+cl_atomic_ptr_xchg_ex(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_new,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	pp_value
+*		[in] Pointer to the pointer to exchange.
+*
+*	p_new
+*		[in] Pointer value to assign.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by pp_value.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_ptr_comp_xchg, cl_atomic_ptr_load,
+*	cl_atomic_ptr_store
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_ptr_comp_xchg
+* NAME
+*	cl_atomic_ptr_comp_xchg
+*
+* DESCRIPTION
+*	The cl_atomic_ptr_comp_xchg function atomically compares a pointer to a
+*	desired value, sets it to a new value if equal, and returns its initial
+*	value.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+cl_atomic_ptr_comp_xchg(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_compare,
+	IN	void* const				p_new );
+
+CL_EXPORT void* CL_API
+cl_atomic_ptr_comp_xchg_ex(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_compare,
+	IN	void* const				p_new,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	pp_value
+*		[in] Pointer to the pointer to exchange.
+*
+*	p_compare
+*		[in] Value to compare to the pointer pointed to by pp_value.
+*
+*	p_new
+*		[in] Value to assign if the pointer matched p_compare.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the initial value pointed to by pp_value.
+*
+* NOTES
+*	Structures that may see a pointer removed and stored again between a
+*	read and the exchange should use cl_atomic_tagged_comp_xchg instead.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_ptr_xchg, cl_atomic_tagged_comp_xchg
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_ptr_load
+* NAME
+*	cl_atomic_ptr_load
+*
+* DESCRIPTION
+*	The cl_atomic_ptr_load function reads a pointer atomically.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+cl_atomic_ptr_load(
+	IN	void* volatile const* const	pp_value );
+
+CL_EXPORT void* CL_API
+cl_atomic_ptr_load_ex(
+	IN	void* volatile const* const	pp_value,
+	IN	const cl_mem_order_t		order );
+/*
+* PARAMETERS
+*	pp_value
+*		[in] Pointer to the pointer to read.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	Returns the value pointed to by pp_value.
+*
+* NOTES
+*	Orderings behave as for cl_atomic_load.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_load, cl_atomic_ptr_store
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_ptr_store
+* NAME
+*	cl_atomic_ptr_store
+*
+* DESCRIPTION
+*	The cl_atomic_ptr_store function writes a pointer atomically.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_atomic_ptr_store(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_new );
+
+CL_EXPORT void CL_API
+cl_atomic_ptr_store_ex(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_new,
+	IN	const cl_mem_order_t	order );
+/*
+* PARAMETERS
+*	pp_value
+*		[in] Pointer to the pointer to write.
+*
+*	p_new
+*		[in] Value to write.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Orderings behave as for cl_atomic_store.  A release store is the usual
+*	way to publish an initialized object to readers.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic_store, cl_atomic_ptr_load
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic128_comp_xchg
+* NAME
+*	cl_atomic128_comp_xchg
+*
+* DESCRIPTION
+*	The cl_atomic128_comp_xchg function atomically compares a 128-bit value
+*	to a desired value and, if equal, sets it to a new value.
+*
+* SYNOPSIS
+*/
+#ifdef CL_ATOMIC128
+CL_EXPORT boolean_t CL_API
+cl_atomic128_comp_xchg(
+	IN	cl_atomic128_t* const		p_dest,
+	IN	cl_atomic128_t* const		p_compare,
+	IN	const cl_atomic128_t* const	p_new );
+
+CL_EXPORT boolean_t CL_API
+cl_atomic128_comp_xchg_ex(
+	IN	cl_atomic128_t* const		p_dest,
+	IN	cl_atomic128_t* const		p_compare,
+	IN	const cl_atomic128_t* const	p_new,
+	IN	const cl_mem_order_t		order );
+#endif
+/*
+* PARAMETERS
+*	p_dest
+*		[in] Pointer to the 128-bit value to update.
+*
+*	p_compare
+*		[in/out] Pointer to the expected value.  If the exchange fails,
+*		receives the current value of p_dest.
+*
+*	p_new
+*		[in] Value to store if p_dest matched p_compare.
+*
+*	order
+*		[in] Memory ordering of the operation.  See cl_mem_order_t.
+*
+* RETURN VALUES
+*	TRUE if the exchange was performed.
+*
+*	FALSE if p_dest did not match p_compare.
+*
+* NOTES
+*	Only available when CL_ATOMIC128 is defined, which is the case on
+*	64-bit platforms.  Code that must also build for 32-bit platforms
+*	should use cl_atomic_tagged_comp_xchg, which is built on this function
+*	where it is available and on cl_atomic64_comp_xchg otherwise.
+*
+* SEE ALSO
+*	Atomic Operations, cl_atomic128_t, cl_atomic_tagged_comp_xchg
+*********/
+
+
+/****f* Component Library: Atomic Operations/cl_atomic_tagged_comp_xchg
+* NAME
+*	cl_atomic_tagged_comp_xchg
+*
+* DESCRIPTION
+*	The cl_atomic_tagged_comp_xchg function atomically compares a tagged
+*	pointer to a desired value and, if equal, sets its pointer to a new
+*	value and increments its tag.
+*
+* SYNOPSIS
+*/
+CL_EXPORT boolean_t CL_API
+cl_atomic_tagged_comp_xchg(
+	IN	cl_tagged_ptr_t* const	p_dest,
+	IN	cl_tagged_ptr_t* const	p_compare,
+	IN	void* const				p_new );
+/*
+* PARAMETERS
+*	p_dest
+*		[in] Pointer to the tagged pointer to update.
+*
+*	p_compare
+*		[in/out] Pointer to the expected pointer and tag.  If the exchange
+*		fails, receives the current value of p_dest.
+*
+*	p_new
+*		[in] Pointer to store if p_dest matched p_compare.
+*
+* RETURN VALUES
+*	TRUE if the exchange was performed.
+*
+*	FALSE if p_dest did not match p_compare.
+*
+* NOTES
+*	Both the pointer and the tag must match for the exchange to succeed.
+*	Since every successful exchange increments the tag, a pointer that was
+*	removed and stored again between a read and the exchange is detected.
+*
+*	p_compare is typically read from p_dest without synchronization.  A
+*	torn read only causes the exchange to fail, returning a consistent
+*	value to retry with.
+*
+*	The exchange uses a 128-bit compare and exchange on 64-bit platforms
+*	and a 64-bit one on 32-bit platforms.
+*
+* SEE ALSO
+*	Atomic Operations, cl_tagged_ptr_t, cl_atomic_comp_xchg
+*********/
+
+
 #ifdef __cplusplus
 }	/* extern "C" */
 #endif
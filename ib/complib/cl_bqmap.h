@@ -0,0 +1,1166 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of B-tree quick map, a cache-friendly ordered map of 64-bit
+ *	keys where the caller provides storage for the items.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_BQMAP_H_
+#define _CL_BQMAP_H_
+
+
+#include <complib/cl_qcomppool.h>
+#include <complib/cl_math.h>
+
+
+/****h* Component Library/B-Tree Quick Map
+* NAME
+*	B-Tree Quick Map
+*
+* DESCRIPTION
+*	B-tree quick map stores user provided cl_bqmap_item_t structures ordered
+*	by a unique 64-bit key (duplicates are not allowed).  It provides the
+*	same functionality as quick map, but stores its keys in wide nodes
+*	instead of in the items themselves, so that a search touches one
+*	cache line per tree level rather than one item per level.  Keys within
+*	a node are searched with a fixed number of branch free compares.
+*
+*	A B-tree quick map of N items has a height of roughly log8(N), so a
+*	lookup in a 40000 item map touches 5 or 6 nodes instead of the 16 or
+*	so items visited by a quick map lookup.
+*
+*	Items are also kept on a sorted list, so that iteration is as cheap as
+*	it is for quick map.
+*
+*	Unlike quick map, B-tree quick map allocates its tree nodes and can
+*	therefore fail insertions due to insufficient memory.  Use quick map in
+*	situations where such insertion failures cannot be tolerated.
+*
+*	B-tree quick map is not thread safe, and users must provide
+*	serialization when adding and removing items from the map.
+*
+*	The B-tree quick map functions operate on a cl_bqmap_t structure which
+*	should be treated as opaque and should be manipulated only through the
+*	provided functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_bqmap_t, cl_bqmap_item_t, cl_bqmap_node_t
+*
+*	Callbacks:
+*		cl_pfn_bqmap_apply_t
+*
+*	Item Manipulation:
+*		cl_bqmap_key
+*
+*	Initialization:
+*		cl_bqmap_construct, cl_bqmap_init, cl_bqmap_destroy
+*
+*	Iteration:
+*		cl_bqmap_end, cl_bqmap_head, cl_bqmap_tail, cl_bqmap_next,
+*		cl_bqmap_prev
+*
+*	Manipulation:
+*		cl_bqmap_insert, cl_bqmap_get, cl_bqmap_remove_item, cl_bqmap_remove,
+*		cl_bqmap_remove_all, cl_bqmap_merge, cl_bqmap_delta
+*
+*	Search:
+*		cl_bqmap_apply_func
+*
+*	Attributes:
+*		cl_bqmap_count, cl_is_bqmap_empty, cl_is_bqmap_inited
+*********/
+
+
+/****d* Component Library: B-Tree Quick Map/CL_BQMAP_NODE_KEYS
+* NAME
+*	CL_BQMAP_NODE_KEYS
+*
+* DESCRIPTION
+*	Number of keys stored in each node of a B-tree quick map.
+*
+* SYNOPSIS
+*/
+#define CL_BQMAP_NODE_KEYS		8
+/*
+* NOTES
+*	Eight 64-bit keys fill exactly one 64-byte cache line.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_node_t, CL_BQMAP_NODE_SIZE
+*********/
+
+
+/****d* Component Library: B-Tree Quick Map/CL_BQMAP_NODE_SIZE
+* NAME
+*	CL_BQMAP_NODE_SIZE
+*
+* DESCRIPTION
+*	Size of a B-tree quick map node, rounded up to a whole number of cache
+*	lines.
+*
+* SYNOPSIS
+*/
+#define __CL_BQMAP_NODE_USED	\
+	(sizeof(uint64_t) * CL_BQMAP_NODE_KEYS + sizeof(uint32_t) + \
+	sizeof(boolean_t) + sizeof(void*) * (CL_BQMAP_NODE_KEYS + 1) + \
+	sizeof(cl_pool_item_t))
+#define CL_BQMAP_NODE_SIZE		\
+	ROUNDUP( __CL_BQMAP_NODE_USED, CL_CACHE_LINE_SIZE )
+/*
+* NOTES
+*	Three cache lines (192 bytes) on 64-bit platforms and two (128 bytes)
+*	on 32-bit platforms.  The fields of a node never exactly fill its
+*	cache lines, so the node's pad array is never empty.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_node_t, CL_BQMAP_NODE_KEYS
+*********/
+
+
+/****s* Component Library: B-Tree Quick Map/cl_bqmap_item_t
+* NAME
+*	cl_bqmap_item_t
+*
+* DESCRIPTION
+*	The cl_bqmap_item_t structure is used by B-tree quick maps to store
+*	objects.
+*
+*	The cl_bqmap_item_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_bqmap_item
+{
+	/* Must be first to allow casting. */
+	cl_pool_item_t			pool_item;
+	uint64_t				key;
+#ifdef _DEBUG_
+	struct _cl_bqmap		*p_map;
+#endif
+
+} cl_bqmap_item_t;
+/*
+* FIELDS
+*	pool_item
+*		Used to store the item in the map's sorted list of items, allowing
+*		constant time traversal.
+*
+*	key
+*		Value that uniquely represents an item in a map.  This value is set
+*		by calling cl_bqmap_insert and can be retrieved by calling
+*		cl_bqmap_key.
+*
+* NOTES
+*	None of the fields of this structure should be manipulated by users, as
+*	they are crititcal to the proper operation of the map in which they
+*	are stored.
+*
+*	As with cl_map_item_t, a B-tree quick map item can be safely cast to a
+*	pool item or a list item.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_insert, cl_bqmap_key, cl_pool_item_t
+*********/
+
+
+/****s* Component Library: B-Tree Quick Map/cl_bqmap_node_t
+* NAME
+*	cl_bqmap_node_t
+*
+* DESCRIPTION
+*	Tree node of a B-tree quick map.
+*
+*	The cl_bqmap_node_t structure is internal to the map and should not be
+*	manipulated by users.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_bqmap_node
+{
+	/* Must be first so that the keys occupy a single cache line. */
+	uint64_t				keys[CL_BQMAP_NODE_KEYS];
+	uint32_t				count;
+	boolean_t				leaf;
+	union _cl_bqmap_node_ptrs
+	{
+		struct _cl_bqmap_node	*p_child[CL_BQMAP_NODE_KEYS + 1];
+		cl_bqmap_item_t			*p_item[CL_BQMAP_NODE_KEYS];
+
+	}	ptrs;
+	cl_pool_item_t			pool_item;
+	uint8_t					pad[CL_BQMAP_NODE_SIZE - __CL_BQMAP_NODE_USED];
+
+} cl_bqmap_node_t;
+/*
+* FIELDS
+*	keys
+*		Sorted keys held by the node.  Slots at and beyond count are set
+*		to CL_CONST64(0xFFFFFFFFFFFFFFFF) so that a full width compare of
+*		all slots never ranks a key past the used slots.
+*
+*		In a leaf node, keys[i] is the key of ptrs.p_item[i].  In an
+*		interior node, keys[i] is the highest key stored below
+*		ptrs.p_child[i], and ptrs.p_child[count] holds all higher keys.
+*
+*	count
+*		Number of keys used in the node.
+*
+*	leaf
+*		TRUE if the node references items rather than child nodes.
+*
+*	ptrs
+*		Child nodes of an interior node, or items of a leaf node.
+*
+*	pool_item
+*		Used by the map's node pool to track free nodes.  The node is
+*		recovered with PARENT_STRUCT( p_pool_item, cl_bqmap_node_t,
+*		pool_item ).
+*
+*	pad
+*		Pads the node to CL_BQMAP_NODE_SIZE.
+*
+* NOTES
+*	Nodes are allocated from a quick composite pool owned by the map, with
+*	the CL_QCPOOL_LAYOUT_SOA layout.  Each grow of the pool then places the
+*	nodes in a page aligned array at a stride of CL_BQMAP_NODE_SIZE, so that
+*	every node starts on a cache line boundary and its keys occupy exactly
+*	one cache line.
+*
+*	pool_item does not overlap ptrs, so that the debug fields of the pool
+*	item stay valid while the node is in use.
+*
+* SEE ALSO
+*	B-Tree Quick Map, CL_BQMAP_NODE_KEYS
+*********/
+
+
+/****s* Component Library: B-Tree Quick Map/cl_bqmap_t
+* NAME
+*	cl_bqmap_t
+*
+* DESCRIPTION
+*	B-tree quick map structure.
+*
+*	The cl_bqmap_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_bqmap
+{
+	cl_bqmap_node_t			*p_root;
+	cl_bqmap_item_t			nil;
+	uint32_t				height;
+	size_t					count;
+	cl_qcpool_t				node_pool;
+	cl_state_t				state;
+
+} cl_bqmap_t;
+/*
+* FIELDS
+*	p_root
+*		Root node of the tree, or NULL if the map is empty.
+*
+*	nil
+*		Map item that serves as the end of the map, as well as providing
+*		the list item used as quick list for storing map items in a list for
+*		faster traversal.
+*
+*	height
+*		Number of node levels in the tree, zero if the map is empty.
+*
+*	count
+*		Number of items in the map.
+*
+*	node_pool
+*		Pool of cl_bqmap_node_t structures used to build the tree, holding
+*		a single component per object.
+*
+*	state
+*		State of the map, used to verify that operations are permitted.
+*
+* SEE ALSO
+*	B-Tree Quick Map
+*********/
+
+
+/****d* Component Library: B-Tree Quick Map/cl_pfn_bqmap_apply_t
+* NAME
+*	cl_pfn_bqmap_apply_t
+*
+* DESCRIPTION
+*	The cl_pfn_bqmap_apply_t function type defines the prototype for
+*	functions used to iterate items in a B-tree quick map.
+*
+* SYNOPSIS
+*/
+typedef void
+(CL_API *cl_pfn_bqmap_apply_t)(
+	IN	cl_bqmap_item_t* const	p_map_item,
+	IN	void*					context );
+/*
+* PARAMETERS
+*	p_map_item
+*		[in] Pointer to a cl_bqmap_item_t structure.
+*
+*	context
+*		[in] Value passed to the callback function.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	This function type is provided as function prototype reference for the
+*	function provided by users as a parameter to the cl_bqmap_apply_func
+*	function.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_apply_func
+*********/
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_count
+* NAME
+*	cl_bqmap_count
+*
+* DESCRIPTION
+*	The cl_bqmap_count function returns the number of items stored
+*	in a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_bqmap_count(
+	IN	const cl_bqmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	return( p_map->count );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure whose item count to return.
+*
+* RETURN VALUE
+*	Returns the number of items stored in the map.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_is_bqmap_empty
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_is_bqmap_empty
+* NAME
+*	cl_is_bqmap_empty
+*
+* DESCRIPTION
+*	The cl_is_bqmap_empty function returns whether a B-tree quick map
+*	is empty.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_bqmap_empty(
+	IN	const cl_bqmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+
+	return( p_map->count == 0 );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure to test for emptiness.
+*
+* RETURN VALUES
+*	TRUE if the B-tree quick map is empty.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_count, cl_bqmap_remove_all
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_key
+* NAME
+*	cl_bqmap_key
+*
+* DESCRIPTION
+*	The cl_bqmap_key function retrieves the key value of a map item.
+*
+* SYNOPSIS
+*/
+CL_INLINE uint64_t CL_API
+cl_bqmap_key(
+	IN	const cl_bqmap_item_t* const	p_item )
+{
+	CL_ASSERT( p_item );
+	return( p_item->key );
+}
+/*
+* PARAMETERS
+*	p_item
+*		[in] Pointer to a map item whose key value to return.
+*
+* RETURN VALUE
+*	Returns the 64-bit key value for the specified map item.
+*
+* NOTES
+*	The key value is set in a call to cl_bqmap_insert.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_insert
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_construct
+* NAME
+*	cl_bqmap_construct
+*
+* DESCRIPTION
+*	The cl_bqmap_construct function constructs a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_bqmap_construct(
+	IN	cl_bqmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_bqmap_init, cl_bqmap_destroy, and cl_is_bqmap_inited.
+*
+*	Calling cl_bqmap_construct is a prerequisite to calling any other
+*	B-tree quick map function except cl_bqmap_init.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_init, cl_bqmap_destroy, cl_is_bqmap_inited
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_is_bqmap_inited
+* NAME
+*	cl_is_bqmap_inited
+*
+* DESCRIPTION
+*	The cl_is_bqmap_inited function returns whether a B-tree quick map was
+*	successfully initialized.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_bqmap_inited(
+	IN	const cl_bqmap_t* const	p_map )
+{
+	/*
+	 * The map's pool of nodes is the last thing initialized.
+	 * We can therefore use it to test for initialization.
+	 */
+	return( cl_is_qcpool_inited( &p_map->node_pool ) );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure whose initialization state
+*		to check.
+*
+* RETURN VALUES
+*	TRUE if the map was initialized successfully.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	B-Tree Quick Map
+*********/
+
+
+/*
+ * Initializer of the map's node pool.  Returns the pool item embedded in
+ * each node.
+ */
+CL_INLINE cl_status_t CL_API
+__cl_bqmap_node_init(
+	IN	void** const			p_comp_array,
+	IN	const uint32_t			num_components,
+	IN	void*					context,
+	OUT	cl_pool_item_t** const	pp_pool_item )
+{
+	cl_bqmap_node_t	*p_node;
+
+	CL_ASSERT( p_comp_array );
+	CL_ASSERT( num_components == 1 );
+	CL_ASSERT( pp_pool_item );
+	UNUSED_PARAM( num_components );
+	UNUSED_PARAM( context );
+
+	p_node = (cl_bqmap_node_t*)p_comp_array[0];
+	*pp_pool_item = &p_node->pool_item;
+	return( CL_SUCCESS );
+}
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_init
+* NAME
+*	cl_bqmap_init
+*
+* DESCRIPTION
+*	The cl_bqmap_init function initializes a B-tree quick map for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_bqmap_init(
+	IN	cl_bqmap_t* const	p_map,
+	IN	const size_t		min_items );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure to initialize.
+*
+*	min_items
+*		[in] Minimum number of items that can be stored without allocating
+*		additional tree nodes.  All necessary node allocations are performed
+*		at initialization time.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the map was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to allocate the
+*	initial tree nodes.
+*
+* NOTES
+*	Allows calling B-tree quick map manipulation functions.
+*
+*	The node pool is initialized with cl_qcpool_init_ex, a single component
+*	of CL_BQMAP_NODE_SIZE bytes, the CL_QCPOOL_LAYOUT_SOA layout so that
+*	nodes are cache line aligned, and __cl_bqmap_node_init as initializer.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_destroy, cl_bqmap_insert, cl_bqmap_remove
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_destroy
+* NAME
+*	cl_bqmap_destroy
+*
+* DESCRIPTION
+*	The cl_bqmap_destroy function destroys a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_bqmap_destroy(
+	IN	cl_bqmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Frees all tree nodes.  cl_bqmap_destroy does not affect any of the items
+*	stored in the map.  This function should only be called after a call to
+*	cl_bqmap_construct or cl_bqmap_init.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_construct, cl_bqmap_init
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_end
+* NAME
+*	cl_bqmap_end
+*
+* DESCRIPTION
+*	The cl_bqmap_end function returns the end of a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_INLINE const cl_bqmap_item_t* const CL_API
+cl_bqmap_end(
+	IN	const cl_bqmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	/* Nil is the end of the map. */
+	return( &p_map->nil );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure whose end to return.
+*
+* RETURN VALUE
+*	Pointer to the end of the map.
+*
+* NOTES
+*	cl_bqmap_end is useful for determining the validity of map items
+*	returned by cl_bqmap_head, cl_bqmap_tail, cl_bqmap_next, cl_bqmap_prev
+*	or cl_bqmap_get.  If the map item pointer returned by any of these
+*	functions compares to the end, the end of the map was encoutered.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_head, cl_bqmap_tail, cl_bqmap_next,
+*	cl_bqmap_prev
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_head
+* NAME
+*	cl_bqmap_head
+*
+* DESCRIPTION
+*	The cl_bqmap_head function returns the map item with the lowest key
+*	value stored in a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_bqmap_item_t* CL_API
+cl_bqmap_head(
+	IN	const cl_bqmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	return( (cl_bqmap_item_t*)p_map->nil.pool_item.list_item.p_next );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure whose item with the lowest
+*		key is returned.
+*
+* RETURN VALUES
+*	Pointer to the map item with the lowest key in the map.
+*
+*	Pointer to the map end if the map was empty.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_tail, cl_bqmap_next, cl_bqmap_prev,
+*	cl_bqmap_end
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_tail
+* NAME
+*	cl_bqmap_tail
+*
+* DESCRIPTION
+*	The cl_bqmap_tail function returns the map item with the highest key
+*	value stored in a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_bqmap_item_t* CL_API
+cl_bqmap_tail(
+	IN	const cl_bqmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	return( (cl_bqmap_item_t*)p_map->nil.pool_item.list_item.p_prev );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure whose item with the highest
+*		key is returned.
+*
+* RETURN VALUES
+*	Pointer to the map item with the highest key in the map.
+*
+*	Pointer to the map end if the map was empty.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_head, cl_bqmap_next, cl_bqmap_prev,
+*	cl_bqmap_end
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_next
+* NAME
+*	cl_bqmap_next
+*
+* DESCRIPTION
+*	The cl_bqmap_next function returns the map item with the next higher
+*	key value than a specified map item.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_bqmap_item_t* CL_API
+cl_bqmap_next(
+	IN	const cl_bqmap_item_t* const	p_item )
+{
+	CL_ASSERT( p_item );
+	return( (cl_bqmap_item_t*)p_item->pool_item.list_item.p_next );
+}
+/*
+* PARAMETERS
+*	p_item
+*		[in] Pointer to a map item whose successor to return.
+*
+* RETURN VALUES
+*	Pointer to the map item with the next higher key value in the map.
+*
+*	Pointer to the map end if the specified item was the last item in
+*	the map.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_head, cl_bqmap_tail, cl_bqmap_prev,
+*	cl_bqmap_end
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_prev
+* NAME
+*	cl_bqmap_prev
+*
+* DESCRIPTION
+*	The cl_bqmap_prev function returns the map item with the next lower
+*	key value than a specified map item.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_bqmap_item_t* CL_API
+cl_bqmap_prev(
+	IN	const cl_bqmap_item_t* const	p_item )
+{
+	CL_ASSERT( p_item );
+	return( (cl_bqmap_item_t*)p_item->pool_item.list_item.p_prev );
+}
+/*
+* PARAMETERS
+*	p_item
+*		[in] Pointer to a map item whose predecessor to return.
+*
+* RETURN VALUES
+*	Pointer to the map item with the next lower key value in the map.
+*
+*	Pointer to the map end if the specified item was the first item in
+*	the map.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_head, cl_bqmap_tail, cl_bqmap_next,
+*	cl_bqmap_end
+*********/
+
+
+/****i* Component Library: B-Tree Quick Map/__cl_bqmap_rank
+* NAME
+*	__cl_bqmap_rank
+*
+* DESCRIPTION
+*	Returns the number of keys in a node that are lower than a given key.
+*
+* SYNOPSIS
+*/
+CL_INLINE uint32_t CL_API
+__cl_bqmap_rank(
+	IN	const cl_bqmap_node_t* const	p_node,
+	IN	const uint64_t					key )
+{
+	uint32_t	i, rank = 0;
+
+	/*
+	 * Compare against every slot so that the loop has a fixed trip count
+	 * and no data dependent branches.  Unused slots hold the highest
+	 * possible key and are never counted.  Compilers unroll this into
+	 * vector compares where available.
+	 */
+	for( i = 0; i < CL_BQMAP_NODE_KEYS; i++ )
+		rank += (p_node->keys[i] < key);
+
+	return( rank );
+}
+/*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_get
+* NAME
+*	cl_bqmap_get
+*
+* DESCRIPTION
+*	The cl_bqmap_get function returns the map item associated with a key.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_bqmap_item_t* CL_API
+cl_bqmap_get(
+	IN	const cl_bqmap_t* const	p_map,
+	IN	const uint64_t			key )
+{
+	const cl_bqmap_node_t	*p_node;
+	uint32_t				rank;
+
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+
+	p_node = p_map->p_root;
+	if( !p_node )
+		return( (cl_bqmap_item_t*)&p_map->nil );
+
+	while( !p_node->leaf )
+		p_node = p_node->ptrs.p_child[__cl_bqmap_rank( p_node, key )];
+
+	rank = __cl_bqmap_rank( p_node, key );
+	if( rank < p_node->count && p_node->keys[rank] == key )
+		return( p_node->ptrs.p_item[rank] );
+
+	return( (cl_bqmap_item_t*)&p_map->nil );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure from which to retrieve the
+*		item with the specified key.
+*
+*	key
+*		[in] Key value used to search for the desired map item.
+*
+* RETURN VALUES
+*	Pointer to the map item with the desired key value.
+*
+*	Pointer to the map end if there was no item with the desired key value
+*	stored in the map.
+*
+* NOTES
+*	cl_bqmap_get does not remove the item from the map.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_remove
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_insert
+* NAME
+*	cl_bqmap_insert
+*
+* DESCRIPTION
+*	The cl_bqmap_insert function inserts a map item into a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_bqmap_item_t* CL_API
+cl_bqmap_insert(
+	IN	cl_bqmap_t* const		p_map,
+	IN	const uint64_t			key,
+	IN	cl_bqmap_item_t* const	p_item );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure into which to add the item.
+*
+*	key
+*		[in] Value to assign to the item.
+*
+*	p_item
+*		[in] Pointer to a cl_bqmap_item_t stucture to insert into the map.
+*
+* RETURN VALUES
+*	Pointer to the item in the map with the specified key.  If insertion
+*	was successful, this is the pointer to the item.  If an item with the
+*	specified key already exists in the map, the pointer to that item is
+*	returned.
+*
+*	NULL if there was not enough memory to split a full node.
+*
+* NOTES
+*	Insertion operations may cause the B-tree quick map to split nodes.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_remove, cl_bqmap_item_t
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_remove_item
+* NAME
+*	cl_bqmap_remove_item
+*
+* DESCRIPTION
+*	The cl_bqmap_remove_item function removes the specified map item
+*	from a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_bqmap_remove_item(
+	IN	cl_bqmap_t* const		p_map,
+	IN	cl_bqmap_item_t* const	p_item );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure from which to remove the item.
+*
+*	p_item
+*		[in] Pointer to a map item to remove from its map.
+*
+* RETURN VALUES
+*	This function does not return a value.
+*
+*	In a debug build, cl_bqmap_remove_item asserts that the item being
+*	removed is in the specified map.
+*
+* NOTES
+*	Removal never allocates memory and cannot fail.  Nodes left less than
+*	half full are merged with or refilled from a neighbouring node.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_remove, cl_bqmap_remove_all, cl_bqmap_insert
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_remove
+* NAME
+*	cl_bqmap_remove
+*
+* DESCRIPTION
+*	The cl_bqmap_remove function removes the map item with the specified key
+*	from a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_bqmap_item_t* CL_API
+cl_bqmap_remove(
+	IN	cl_bqmap_t* const	p_map,
+	IN	const uint64_t		key );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure from which to remove the item
+*		with the specified key.
+*
+*	key
+*		[in] Key value used to search for the map item to remove.
+*
+* RETURN VALUES
+*	Pointer to the removed map item if it was found.
+*
+*	Pointer to the map end if no item with the specified key exists in the
+*	map.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_remove_item, cl_bqmap_remove_all,
+*	cl_bqmap_insert
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_remove_all
+* NAME
+*	cl_bqmap_remove_all
+*
+* DESCRIPTION
+*	The cl_bqmap_remove_all function removes all items in a B-tree quick
+*	map, leaving it empty.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_bqmap_remove_all(
+	IN	cl_bqmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure to empty.
+*
+* RETURN VALUES
+*	This function does not return a value.
+*
+* NOTES
+*	All tree nodes are returned to the map's node pool.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_remove, cl_bqmap_remove_item
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_merge
+* NAME
+*	cl_bqmap_merge
+*
+* DESCRIPTION
+*	The cl_bqmap_merge function moves all items from one map to another,
+*	excluding duplicates.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_bqmap_merge(
+	OUT		cl_bqmap_t* const	p_dest_map,
+	IN OUT	cl_bqmap_t* const	p_src_map );
+/*
+* PARAMETERS
+*	p_dest_map
+*		[out] Pointer to a cl_bqmap_t structure to which items should be
+*		added.
+*
+*	p_src_map
+*		[in/out] Pointer to a cl_bqmap_t structure whose items to add
+*		to p_dest_map.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the operation succeeded.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the operation
+*	to succeed.
+*
+* NOTES
+*	Items are evaluated based on their keys only.
+*
+*	Upon return from cl_bqmap_merge, the map referenced by p_src_map
+*	contains all duplicate items.
+*
+*	Upon failure, items already moved remain in p_dest_map and all other
+*	items remain in p_src_map.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_delta
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_delta
+* NAME
+*	cl_bqmap_delta
+*
+* DESCRIPTION
+*	The cl_bqmap_delta function computes the differences between two maps.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_bqmap_delta(
+	IN OUT	cl_bqmap_t* const	p_map1,
+	IN OUT	cl_bqmap_t* const	p_map2,
+	OUT		cl_bqmap_t* const	p_new,
+	OUT		cl_bqmap_t* const	p_old );
+/*
+* PARAMETERS
+*	p_map1
+*		[in/out] Pointer to the first of two cl_bqmap_t structures whose
+*		differences to compute.
+*
+*	p_map2
+*		[in/out] Pointer to the second of two cl_bqmap_t structures whose
+*		differences to compute.
+*
+*	p_new
+*		[out] Pointer to an empty cl_bqmap_t structure that contains the
+*		items unique to p_map2 upon return from the function.
+*
+*	p_old
+*		[out] Pointer to an empty cl_bqmap_t structure that contains the
+*		items unique to p_map1 upon return from the function.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the operation succeeded.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the operation
+*	to succeed.
+*
+* NOTES
+*	Items are evaluated based on their keys.  Items that exist in both
+*	p_map1 and p_map2 remain in their respective maps.  Items that
+*	exist only p_map1 are moved to p_old.  Likewise, items that exist only
+*	in p_map2 are moved to p_new.
+*
+*	Both maps pointed to by p_new and p_old must be empty on input.
+*
+*	Upon failure, all input maps are restored to their original state.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_bqmap_merge
+*********/
+
+
+/****f* Component Library: B-Tree Quick Map/cl_bqmap_apply_func
+* NAME
+*	cl_bqmap_apply_func
+*
+* DESCRIPTION
+*	The cl_bqmap_apply_func function executes a specified function
+*	for every item stored in a B-tree quick map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_bqmap_apply_func(
+	IN	const cl_bqmap_t* const	p_map,
+	IN	cl_pfn_bqmap_apply_t	pfn_func,
+	IN	const void* const		context );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_bqmap_t structure.
+*
+*	pfn_func
+*		[in] Function invoked for every item in the map.
+*		See the cl_pfn_bqmap_apply_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback functions to provide context.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The function provided must not perform any map operations, as these
+*	would corrupt the map.
+*
+* SEE ALSO
+*	B-Tree Quick Map, cl_pfn_bqmap_apply_t
+*********/
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif	/* _CL_BQMAP_H_ */
@@ -0,0 +1,1607 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of chunk list, an unrolled list of object pointers.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_CHUNK_LIST_H_
+#define _CL_CHUNK_LIST_H_
+
+
+#include <complib/cl_list.h>
+
+
+/****h* Component Library/Chunk List
+* NAME
+*	Chunk List
+*
+* DESCRIPTION
+*	Chunk List stores pointers to objects in a doubly linked list of
+*	fixed size arrays, called chunks.
+*
+*	Chunk list provides the same functionality as list, but stores up to
+*	CL_CHUNK_LIST_OBJS object pointers per list link.  Walking the list
+*	touches one chunk per CL_CHUNK_LIST_OBJS objects rather than one list
+*	item per object, and insertions at the head or tail only allocate
+*	when the chunk at that end is full.
+*
+*	Insertion operations on a chunk list can fail, and callers should trap
+*	for such failures.
+*
+*	Chunk list is not thread safe, and users must provide serialization.
+*
+*	The chunk list functions operate on a cl_chunk_list_t structure which
+*	should be treated as opaque and should be manipulated only through the
+*	provided functions.
+*
+* SEE ALSO
+*	Types:
+*		cl_chunk_list_iterator_t
+*
+*	Structures:
+*		cl_chunk_list_t, cl_list_chunk_hdr_t, cl_list_chunk_t
+*
+*	Callbacks:
+*		cl_pfn_list_apply_t, cl_pfn_list_find_t
+*
+*	Initialization/Destruction:
+*		cl_chunk_list_construct, cl_chunk_list_init, cl_chunk_list_destroy
+*
+*	Iteration:
+*		cl_chunk_list_next, cl_chunk_list_prev, cl_chunk_list_head,
+*		cl_chunk_list_tail, cl_chunk_list_end, cl_chunk_list_is_end,
+*		cl_chunk_list_obj
+*
+*	Manipulation:
+*		cl_chunk_list_insert_head, cl_chunk_list_insert_tail,
+*		cl_chunk_list_insert_array_head, cl_chunk_list_insert_array_tail,
+*		cl_chunk_list_insert_prev, cl_chunk_list_insert_next,
+*		cl_chunk_list_remove_head, cl_chunk_list_remove_tail,
+*		cl_chunk_list_remove_object, cl_chunk_list_remove_item,
+*		cl_chunk_list_remove_all
+*
+*	Search:
+*		cl_is_object_in_chunk_list, cl_chunk_list_find_from_head,
+*		cl_chunk_list_find_from_tail, cl_chunk_list_apply_func
+*
+*	Attributes:
+*		cl_chunk_list_count, cl_is_chunk_list_empty,
+*		cl_is_chunk_list_inited
+*
+* NOTES
+*	Code using list can be converted by renaming cl_list_* to
+*	cl_chunk_list_*.  Since chunk list iterators are structures, loops
+*	comparing an iterator to cl_list_end must instead test the iterator
+*	with cl_chunk_list_is_end.
+*********/
+
+
+/****s* Component Library: Chunk List/cl_list_chunk_hdr_t
+* NAME
+*	cl_list_chunk_hdr_t
+*
+* DESCRIPTION
+*	Header of a chunk stored in a chunk list.
+*
+*	The cl_list_chunk_hdr_t structure is internal to the list and should
+*	not be manipulated by users.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_list_chunk_hdr
+{
+	/* Must be first to allow returning chunks to the pool. */
+	cl_pool_item_t			pool_item;
+	uint32_t				first;
+	uint32_t				last;
+
+} cl_list_chunk_hdr_t;
+/*
+* FIELDS
+*	pool_item
+*		Used to store the chunk in the chunk pool while free, and whose
+*		list item links the chunk into the list while in use.
+*
+*	first
+*		Index of the first used object slot of the chunk.
+*
+*	last
+*		Index one past the last used object slot of the chunk.
+*
+* SEE ALSO
+*	Chunk List, cl_list_chunk_t
+*********/
+
+
+/****d* Component Library: Chunk List/CL_CHUNK_LIST_OBJS
+* NAME
+*	CL_CHUNK_LIST_OBJS
+*
+* DESCRIPTION
+*	Number of object pointers stored in a chunk.
+*
+* SYNOPSIS
+*/
+#define CL_CHUNK_LIST_OBJS	\
+	((2 * CL_CACHE_LINE_SIZE - sizeof(cl_list_chunk_hdr_t)) / sizeof(void*))
+/*
+* NOTES
+*	The value is chosen so that a chunk, including its header, occupies
+*	exactly two cache lines.  This allows 13 objects per chunk in 64-bit
+*	free builds and 28 objects per chunk in 32-bit free builds.
+*
+* SEE ALSO
+*	Chunk List, cl_list_chunk_t
+*********/
+
+
+/****s* Component Library: Chunk List/cl_list_chunk_t
+* NAME
+*	cl_list_chunk_t
+*
+* DESCRIPTION
+*	Chunk of object pointers stored in a chunk list.
+*
+*	The cl_list_chunk_t structure is internal to the list and should not
+*	be manipulated by users.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_list_chunk
+{
+	cl_list_chunk_hdr_t		hdr;
+	const void				*p_objects[CL_CHUNK_LIST_OBJS];
+
+} cl_list_chunk_t;
+/*
+* FIELDS
+*	hdr
+*		Chunk header, holding the list linkage and the range of used
+*		slots.
+*
+*	p_objects
+*		Object pointers.  Only slots from hdr.first up to but not
+*		including hdr.last are valid.
+*
+* NOTES
+*	Chunks in a list are never empty.  A chunk is returned to the chunk
+*	pool as soon as its last object is removed.
+*
+*	Chunks are allocated from a quick composite pool owned by the list,
+*	with the CL_QCPOOL_LAYOUT_SOA layout.  Each grow of the pool places the
+*	chunks in a page aligned array at a stride of two cache lines, so that
+*	every chunk starts on a cache line boundary.
+*
+* SEE ALSO
+*	Chunk List, cl_list_chunk_hdr_t, CL_CHUNK_LIST_OBJS
+*********/
+
+
+/****s* Component Library: Chunk List/cl_chunk_list_t
+* NAME
+*	cl_chunk_list_t
+*
+* DESCRIPTION
+*	Chunk list structure.
+*
+*	The cl_chunk_list_t structure should be treated as opaque and should be
+*	manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_chunk_list
+{
+	cl_list_chunk_hdr_t		end;
+	size_t					count;
+	cl_qcpool_t				chunk_pool;
+
+} cl_chunk_list_t;
+/*
+* FIELDS
+*	end
+*		Chunk header that serves as the end of the list.  Its list item
+*		links to the head and tail chunks.  It holds no objects.  Its first
+*		field is set to CL_CHUNK_LIST_OBJS and its last field to one more,
+*		so that the end iterator can be recognized without a reference to
+*		the list, and so that stepping off either end of the list lands
+*		on the end iterator.
+*
+*	count
+*		Number of objects stored in the list.
+*
+*	chunk_pool
+*		Quick composite pool of cl_list_chunk_t structures, holding a
+*		single component per object.
+*
+* SEE ALSO
+*	Chunk List
+*********/
+
+
+/****d* Component Library: Chunk List/cl_chunk_list_iterator_t
+* NAME
+*	cl_chunk_list_iterator_t
+*
+* DESCRIPTION
+*	Iterator type used to walk a chunk list.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_chunk_list_iterator
+{
+	const cl_list_chunk_hdr_t	*p_hdr;
+	uint32_t					index;
+
+} cl_chunk_list_iterator_t;
+/*
+* FIELDS
+*	p_hdr
+*		Chunk holding the object.
+*
+*	index
+*		Slot of the object in the chunk.
+*
+* NOTES
+*	The iterator should be treated as opaque to prevent corrupting the list.
+*	Iterators are passed and returned by value.
+*
+*	Any insertion or removal invalidates all iterators to the list, except
+*	that an iterator returned by cl_chunk_list_insert_prev or
+*	cl_chunk_list_insert_next is valid until the next modification.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next,
+*	cl_chunk_list_prev, cl_chunk_list_obj, cl_chunk_list_is_end
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_construct
+* NAME
+*	cl_chunk_list_construct
+*
+* DESCRIPTION
+*	The cl_chunk_list_construct function constructs a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_chunk_list_construct(
+	IN	cl_chunk_list_t* const	p_list );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to cl_chunk_list_t object whose state to initialize.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_chunk_list_init, cl_chunk_list_destroy and
+*	cl_is_chunk_list_inited.
+*
+*	Calling cl_chunk_list_construct is a prerequisite to calling any other
+*	chunk list function except cl_chunk_list_init.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_init, cl_chunk_list_destroy,
+*	cl_is_chunk_list_inited
+*********/
+
+
+/****f* Component Library: Chunk List/cl_is_chunk_list_inited
+* NAME
+*	cl_is_chunk_list_inited
+*
+* DESCRIPTION
+*	The cl_is_chunk_list_inited function returns whether a chunk list was
+*	initialized successfully.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_chunk_list_inited(
+	IN	const cl_chunk_list_t* const	p_list )
+{
+	CL_ASSERT( p_list );
+	/*
+	 * The pool is the last thing initialized.  If it is initialized, the
+	 * list is initialized too.
+	 */
+	return( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure whose initilization
+*		state to check.
+*
+* RETURN VALUES
+*	TRUE if the list was initialized successfully.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	Chunk List
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_init
+* NAME
+*	cl_chunk_list_init
+*
+* DESCRIPTION
+*	The cl_chunk_list_init function initializes a chunk list for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_chunk_list_init(
+	IN	cl_chunk_list_t* const	p_list,
+	IN	const size_t			min_items );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to cl_chunk_list_t structure to initialize.
+*
+*	min_items
+*		[in] Minimum number of objects that can be stored.  Enough chunks
+*		to store min_items objects are allocated at initialization time.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the list was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for initialization.
+*
+* NOTES
+*	The list is guaranteed to store min_items objects when they are only
+*	inserted and removed at the ends of the list.  Insertions in the middle
+*	of the list may split chunks, leaving slots unused.
+*
+*	The chunk pool is initialized with cl_qcpool_init_ex, a single component
+*	of sizeof(cl_list_chunk_t) bytes and the CL_QCPOOL_LAYOUT_SOA layout, so
+*	that chunks are cache line aligned.  No initializer is needed, since the
+*	pool item of a chunk is at the start of its header.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_construct, cl_chunk_list_destroy,
+*	cl_chunk_list_insert_head, cl_chunk_list_insert_tail
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_destroy
+* NAME
+*	cl_chunk_list_destroy
+*
+* DESCRIPTION
+*	The cl_chunk_list_destroy function destroys a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_chunk_list_destroy(
+	IN	cl_chunk_list_t* const	p_list );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to cl_chunk_list_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	cl_chunk_list_destroy does not affect any of the objects stored in the
+*	list, but does release all memory allocated internally.  Further
+*	operations should not be attempted on the list after
+*	cl_chunk_list_destroy is invoked.
+*
+*	This function should only be called after a call to
+*	cl_chunk_list_construct or cl_chunk_list_init.
+*
+*	In debug builds, cl_chunk_list_destroy asserts if the list is not empty.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_construct, cl_chunk_list_init
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_count
+* NAME
+*	cl_chunk_list_count
+*
+* DESCRIPTION
+*	The cl_chunk_list_count function returns the number of objects stored
+*	in a chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_chunk_list_count(
+	IN	const cl_chunk_list_t* const	p_list )
+{
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	return( p_list->count );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure whose objects to count.
+*
+* RETURN VALUE
+*	Number of objects stored in the specified list.
+*
+* SEE ALSO
+*	Chunk List
+*********/
+
+
+/****f* Component Library: Chunk List/cl_is_chunk_list_empty
+* NAME
+*	cl_is_chunk_list_empty
+*
+* DESCRIPTION
+*	The cl_is_chunk_list_empty function returns whether a chunk list is
+*	empty.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_chunk_list_empty(
+	IN	const cl_chunk_list_t* const	p_list )
+{
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	return( !p_list->count );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure.
+*
+* RETURN VALUES
+*	TRUE if the specified list is empty.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_count, cl_chunk_list_remove_all
+*********/
+
+
+/****i* Component Library: Chunk List/__cl_chunk_list_head_chunk
+* NAME
+*	__cl_chunk_list_head_chunk
+*
+* DESCRIPTION
+*	Returns the chunk at the head of a chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_list_chunk_t* CL_API
+__cl_chunk_list_head_chunk(
+	IN	const cl_chunk_list_t* const	p_list )
+{
+	return( (cl_list_chunk_t*)p_list->end.pool_item.list_item.p_next );
+}
+/*
+* NOTES
+*	Returns a pointer to the end header if the list is empty.
+*********/
+
+
+/****i* Component Library: Chunk List/__cl_chunk_list_tail_chunk
+* NAME
+*	__cl_chunk_list_tail_chunk
+*
+* DESCRIPTION
+*	Returns the chunk at the tail of a chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_list_chunk_t* CL_API
+__cl_chunk_list_tail_chunk(
+	IN	const cl_chunk_list_t* const	p_list )
+{
+	return( (cl_list_chunk_t*)p_list->end.pool_item.list_item.p_prev );
+}
+/*
+* NOTES
+*	Returns a pointer to the end header if the list is empty.
+*********/
+
+
+/****i* Component Library: Chunk List/__cl_chunk_list_link
+* NAME
+*	__cl_chunk_list_link
+*
+* DESCRIPTION
+*	Links a chunk into a chunk list after a given chunk header.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+__cl_chunk_list_link(
+	IN	cl_list_chunk_hdr_t* const	p_prev,
+	IN	cl_list_chunk_t* const		p_chunk )
+{
+	cl_list_item_t	*p_item = &p_chunk->hdr.pool_item.list_item;
+	cl_list_item_t	*p_prev_item = &p_prev->pool_item.list_item;
+
+	p_item->p_prev = p_prev_item;
+	p_item->p_next = p_prev_item->p_next;
+	p_prev_item->p_next->p_prev = p_item;
+	p_prev_item->p_next = p_item;
+}
+/*********/
+
+
+/****i* Component Library: Chunk List/__cl_chunk_list_unlink
+* NAME
+*	__cl_chunk_list_unlink
+*
+* DESCRIPTION
+*	Unlinks an empty chunk from a chunk list and returns it to the pool.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+__cl_chunk_list_unlink(
+	IN	cl_chunk_list_t* const	p_list,
+	IN	cl_list_chunk_t* const	p_chunk )
+{
+	cl_list_item_t	*p_item = &p_chunk->hdr.pool_item.list_item;
+
+	CL_ASSERT( p_chunk->hdr.first == p_chunk->hdr.last );
+
+	p_item->p_prev->p_next = p_item->p_next;
+	p_item->p_next->p_prev = p_item->p_prev;
+	cl_qcpool_put( &p_list->chunk_pool, &p_chunk->hdr.pool_item );
+}
+/*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_insert_head
+* NAME
+*	cl_chunk_list_insert_head
+*
+* DESCRIPTION
+*	The cl_chunk_list_insert_head function inserts an object at the head of
+*	a chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_status_t CL_API
+cl_chunk_list_insert_head(
+	IN	cl_chunk_list_t* const	p_list,
+	IN	const void* const		p_object )
+{
+	cl_list_chunk_t	*p_chunk;
+
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	p_chunk = __cl_chunk_list_head_chunk( p_list );
+	/* The end header has first set to CL_CHUNK_LIST_OBJS. */
+	if( &p_chunk->hdr == &p_list->end || !p_chunk->hdr.first )
+	{
+		/* Get a new chunk, filled from its last slot down. */
+		p_chunk = (cl_list_chunk_t*)cl_qcpool_get( &p_list->chunk_pool );
+		if( !p_chunk )
+			return( CL_INSUFFICIENT_MEMORY );
+
+		p_chunk->hdr.first = (uint32_t)CL_CHUNK_LIST_OBJS;
+		p_chunk->hdr.last = (uint32_t)CL_CHUNK_LIST_OBJS;
+		__cl_chunk_list_link( &p_list->end, p_chunk );
+	}
+
+	p_chunk->p_objects[--p_chunk->hdr.first] = p_object;
+	p_list->count++;
+	return( CL_SUCCESS );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure into which to insert
+*		the object.
+*
+*	p_object
+*		[in] Pointer to an object to insert into the list.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the insertion was successful.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the insertion.
+*
+* NOTES
+*	Inserts the specified object at the head of the list.  A chunk is only
+*	allocated when the chunk at the head of the list has no free slot
+*	before its first object.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_insert_tail, cl_chunk_list_insert_array_head,
+*	cl_chunk_list_insert_prev, cl_chunk_list_insert_next,
+*	cl_chunk_list_remove_head
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_insert_tail
+* NAME
+*	cl_chunk_list_insert_tail
+*
+* DESCRIPTION
+*	The cl_chunk_list_insert_tail function inserts an object at the tail of
+*	a chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_status_t CL_API
+cl_chunk_list_insert_tail(
+	IN	cl_chunk_list_t* const	p_list,
+	IN	const void* const		p_object )
+{
+	cl_list_chunk_t	*p_chunk;
+
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	p_chunk = __cl_chunk_list_tail_chunk( p_list );
+	if( &p_chunk->hdr == &p_list->end ||
+		p_chunk->hdr.last == CL_CHUNK_LIST_OBJS )
+	{
+		/* Get a new chunk, filled from its first slot up. */
+		p_chunk = (cl_list_chunk_t*)cl_qcpool_get( &p_list->chunk_pool );
+		if( !p_chunk )
+			return( CL_INSUFFICIENT_MEMORY );
+
+		p_chunk->hdr.first = 0;
+		p_chunk->hdr.last = 0;
+		__cl_chunk_list_link(
+			(cl_list_chunk_hdr_t*)p_list->end.pool_item.list_item.p_prev,
+			p_chunk );
+	}
+
+	p_chunk->p_objects[p_chunk->hdr.last++] = p_object;
+	p_list->count++;
+	return( CL_SUCCESS );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure into which to insert
+*		the object.
+*
+*	p_object
+*		[in] Pointer to an object to insert into the list.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the insertion was successful.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the insertion.
+*
+* NOTES
+*	Inserts the specified object at the tail of the list.  A chunk is only
+*	allocated when the chunk at the tail of the list has no free slot
+*	after its last object.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_insert_head, cl_chunk_list_insert_array_tail,
+*	cl_chunk_list_insert_prev, cl_chunk_list_insert_next,
+*	cl_chunk_list_remove_tail
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_insert_array_head
+* NAME
+*	cl_chunk_list_insert_array_head
+*
+* DESCRIPTION:
+*	The cl_chunk_list_insert_array_head function inserts an array of objects
+*	at the head of a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_chunk_list_insert_array_head(
+	IN	cl_chunk_list_t* const	p_list,
+	IN	const void* const		p_array,
+	IN	uint32_t				item_count,
+	IN	const uint32_t			item_size );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure into which to insert
+*		the objects.
+*
+*	p_array
+*		[in] Pointer to the first object in an array.
+*
+*	item_count
+*		[in] Number of objects in the array.
+*
+*	item_size
+*		[in] Size of the objects added to the list.  This is the stride in the
+*		array from one object to the next.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the insertion was successful.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the insertion.
+*
+* NOTES
+*	Inserts all objects in the array to the head of the list, preserving the
+*	ordering of the objects.  If not successful, no items are added.
+*	All needed chunks are taken from the pool before any object is
+*	inserted.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_insert_array_tail, cl_chunk_list_insert_head
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_insert_array_tail
+* NAME
+*	cl_chunk_list_insert_array_tail
+*
+* DESCRIPTION
+*	The cl_chunk_list_insert_array_tail function inserts an array of objects
+*	at the tail of a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_chunk_list_insert_array_tail(
+	IN	cl_chunk_list_t* const	p_list,
+	IN	const void* const		p_array,
+	IN	uint32_t				item_count,
+	IN	const uint32_t			item_size );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure into which to insert
+*		the objects.
+*
+*	p_array
+*		[in] Pointer to the first object in an array.
+*
+*	item_count
+*		[in] Number of objects in the array.
+*
+*	item_size
+*		[in] Size of the objects added to the list.  This is the stride in the
+*		array from one object to the next.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the insertion was successful.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the insertion.
+*
+* NOTES
+*	Inserts all objects in the array to the tail of the list, preserving the
+*	ordering of the objects.  If not successful, no items are added.
+*	All needed chunks are taken from the pool before any object is
+*	inserted.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_insert_array_head, cl_chunk_list_insert_tail
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_insert_next
+* NAME
+*	cl_chunk_list_insert_next
+*
+* DESCRIPTION
+*	The cl_chunk_list_insert_next function inserts an object in a chunk list
+*	after the object associated with a given iterator.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_chunk_list_insert_next(
+	IN	cl_chunk_list_t* const				p_list,
+	IN	const cl_chunk_list_iterator_t		iterator,
+	IN	const void* const					p_object,
+	OUT	cl_chunk_list_iterator_t* const		p_iterator OPTIONAL );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure into which to insert
+*		the object.
+*
+*	iterator
+*		[in] cl_chunk_list_iterator_t returned by a previous call to
+*		cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next, or
+*		cl_chunk_list_prev.
+*
+*	p_object
+*		[in] Pointer to an object to insert into the list.
+*
+*	p_iterator
+*		[out] Optional pointer to an iterator that receives the position of
+*		the inserted object.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the insertion was successful.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the insertion.
+*
+* NOTES
+*	Objects following the insertion point are moved within their chunk.
+*	If the chunk is full, it is split in two, which allocates a chunk.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_insert_prev, cl_chunk_list_insert_head,
+*	cl_chunk_list_insert_tail
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_insert_prev
+* NAME
+*	cl_chunk_list_insert_prev
+*
+* DESCRIPTION
+*	The cl_chunk_list_insert_prev function inserts an object in a chunk list
+*	before the object associated with a given iterator.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_chunk_list_insert_prev(
+	IN	cl_chunk_list_t* const				p_list,
+	IN	const cl_chunk_list_iterator_t		iterator,
+	IN	const void* const					p_object,
+	OUT	cl_chunk_list_iterator_t* const		p_iterator OPTIONAL );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure into which to insert
+*		the object.
+*
+*	iterator
+*		[in] cl_chunk_list_iterator_t returned by a previous call to
+*		cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next, or
+*		cl_chunk_list_prev.
+*
+*	p_object
+*		[in] Pointer to an object to insert into the list.
+*
+*	p_iterator
+*		[out] Optional pointer to an iterator that receives the position of
+*		the inserted object.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the insertion was successful.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the insertion.
+*
+* NOTES
+*	Passing the end iterator inserts the object at the tail of the list.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_insert_next, cl_chunk_list_insert_head,
+*	cl_chunk_list_insert_tail
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_remove_head
+* NAME
+*	cl_chunk_list_remove_head
+*
+* DESCRIPTION
+*	The cl_chunk_list_remove_head function removes an object from the head
+*	of a chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_chunk_list_remove_head(
+	IN	cl_chunk_list_t* const	p_list )
+{
+	cl_list_chunk_t	*p_chunk;
+	const void		*p_object;
+
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	/* See if the list is empty. */
+	if( !p_list->count )
+		return( NULL );
+
+	p_chunk = __cl_chunk_list_head_chunk( p_list );
+	p_object = p_chunk->p_objects[p_chunk->hdr.first++];
+	p_list->count--;
+
+	/* Return the chunk to the pool once it is drained. */
+	if( p_chunk->hdr.first == p_chunk->hdr.last )
+		__cl_chunk_list_unlink( p_list, p_chunk );
+
+	return( (void*)p_object );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure from which to remove
+*		an object.
+*
+* RETURN VALUES
+*	Returns the pointer to the object formerly at the head of the list.
+*
+*	NULL if the list was empty.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_remove_tail, cl_chunk_list_remove_all,
+*	cl_chunk_list_remove_object, cl_chunk_list_remove_item,
+*	cl_chunk_list_insert_head
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_remove_tail
+* NAME
+*	cl_chunk_list_remove_tail
+*
+* DESCRIPTION
+*	The cl_chunk_list_remove_tail function removes an object from the tail
+*	of a chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_chunk_list_remove_tail(
+	IN	cl_chunk_list_t* const	p_list )
+{
+	cl_list_chunk_t	*p_chunk;
+	const void		*p_object;
+
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	/* See if the list is empty. */
+	if( !p_list->count )
+		return( NULL );
+
+	p_chunk = __cl_chunk_list_tail_chunk( p_list );
+	p_object = p_chunk->p_objects[--p_chunk->hdr.last];
+	p_list->count--;
+
+	/* Return the chunk to the pool once it is drained. */
+	if( p_chunk->hdr.first == p_chunk->hdr.last )
+		__cl_chunk_list_unlink( p_list, p_chunk );
+
+	return( (void*)p_object );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure from which to remove
+*		an object.
+*
+* RETURN VALUES
+*	Returns the pointer to the object formerly at the tail of the list.
+*
+*	NULL if the list was empty.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_remove_head, cl_chunk_list_remove_all,
+*	cl_chunk_list_remove_object, cl_chunk_list_remove_item,
+*	cl_chunk_list_insert_tail
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_remove_all
+* NAME
+*	cl_chunk_list_remove_all
+*
+* DESCRIPTION
+*	The cl_chunk_list_remove_all function removes all objects from a chunk
+*	list, leaving it empty.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_chunk_list_remove_all(
+	IN	cl_chunk_list_t* const	p_list );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure from which to remove all
+*		objects.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	All chunks are returned to the chunk pool.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_remove_head, cl_chunk_list_remove_tail,
+*	cl_chunk_list_remove_object, cl_chunk_list_remove_item
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_remove_object
+* NAME
+*	cl_chunk_list_remove_object
+*
+* DESCRIPTION
+*	The cl_chunk_list_remove_object function removes a specific object from
+*	a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_chunk_list_remove_object(
+	IN	cl_chunk_list_t* const	p_list,
+	IN	const void* const		p_object );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure from which to remove
+*		the object.
+*
+*	p_object
+*		[in] Pointer to an object to remove from the list.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the object was removed.
+*
+*	CL_NOT_FOUND if the object was not found in the list.
+*
+* NOTES
+*	Removes the first occurrence of an object from a list.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_remove_item, cl_chunk_list_remove_head,
+*	cl_chunk_list_remove_tail, cl_chunk_list_remove_all
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_remove_item
+* NAME
+*	cl_chunk_list_remove_item
+*
+* DESCRIPTION
+*	The cl_chunk_list_remove_item function removes the object associated
+*	with an iterator from a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_chunk_list_remove_item(
+	IN	cl_chunk_list_t* const			p_list,
+	IN	const cl_chunk_list_iterator_t	iterator );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure from which to remove
+*		the object.
+*
+*	iterator
+*		[in] cl_chunk_list_iterator_t returned by a previous call to
+*		cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next, or
+*		cl_chunk_list_prev.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The remaining objects of the chunk are moved to close the gap, from
+*	whichever side of the removed object holds fewer of them.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_remove_object, cl_chunk_list_remove_head,
+*	cl_chunk_list_remove_tail, cl_chunk_list_remove_all
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_end
+* NAME
+*	cl_chunk_list_end
+*
+* DESCRIPTION
+*	The cl_chunk_list_end function returns the iterator for the end of a
+*	chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_chunk_list_iterator_t CL_API
+cl_chunk_list_end(
+	IN	const cl_chunk_list_t* const	p_list )
+{
+	cl_chunk_list_iterator_t	itor;
+
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	itor.p_hdr = &p_list->end;
+	itor.index = p_list->end.first;
+	return( itor );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure for which the end
+*		iterator is to be returned.
+*
+* RETURN VALUE
+*	cl_chunk_list_iterator_t for the end of the list.
+*
+* NOTES
+*	Iterators are structures and cannot be compared directly.  Use
+*	cl_chunk_list_is_end to test for the end of the list.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_is_end, cl_chunk_list_head,
+*	cl_chunk_list_tail
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_is_end
+* NAME
+*	cl_chunk_list_is_end
+*
+* DESCRIPTION
+*	The cl_chunk_list_is_end function returns whether an iterator is the
+*	end of its chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_chunk_list_is_end(
+	IN	const cl_chunk_list_iterator_t	iterator )
+{
+	CL_ASSERT( iterator.p_hdr );
+
+	/* Only the end header has no valid slot at its first index. */
+	return( iterator.index == CL_CHUNK_LIST_OBJS );
+}
+/*
+* PARAMETERS
+*	iterator
+*		[in] cl_chunk_list_iterator_t returned by a previous call to
+*		cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next,
+*		cl_chunk_list_prev or cl_chunk_list_end.
+*
+* RETURN VALUES
+*	TRUE if the iterator is the end of the list.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_end
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_head
+* NAME
+*	cl_chunk_list_head
+*
+* DESCRIPTION
+*	The cl_chunk_list_head function returns an iterator for the head of a
+*	chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_chunk_list_iterator_t CL_API
+cl_chunk_list_head(
+	IN	const cl_chunk_list_t* const	p_list )
+{
+	cl_chunk_list_iterator_t	itor;
+
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	itor.p_hdr = &__cl_chunk_list_head_chunk( p_list )->hdr;
+	itor.index = itor.p_hdr->first;
+	return( itor );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure for which the iterator
+*		for the object at the head is to be returned.
+*
+* RETURN VALUES
+*	cl_chunk_list_iterator_t for the head of the list.
+*
+*	cl_chunk_list_iterator_t for the end of the list if the list is empty.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_tail, cl_chunk_list_next, cl_chunk_list_prev,
+*	cl_chunk_list_end, cl_chunk_list_obj
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_tail
+* NAME
+*	cl_chunk_list_tail
+*
+* DESCRIPTION
+*	The cl_chunk_list_tail function returns an iterator for the tail of a
+*	chunk list.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_chunk_list_iterator_t CL_API
+cl_chunk_list_tail(
+	IN	const cl_chunk_list_t* const	p_list )
+{
+	cl_chunk_list_iterator_t	itor;
+
+	CL_ASSERT( p_list );
+	CL_ASSERT( cl_is_qcpool_inited( &p_list->chunk_pool ) );
+
+	itor.p_hdr = &__cl_chunk_list_tail_chunk( p_list )->hdr;
+	itor.index = itor.p_hdr->last - 1;
+	return( itor );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure for which the iterator
+*		for the object at the tail is to be returned.
+*
+* RETURN VALUES
+*	cl_chunk_list_iterator_t for the tail of the list.
+*
+*	cl_chunk_list_iterator_t for the end of the list if the list is empty.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_head, cl_chunk_list_next, cl_chunk_list_prev,
+*	cl_chunk_list_end, cl_chunk_list_obj
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_next
+* NAME
+*	cl_chunk_list_next
+*
+* DESCRIPTION
+*	The cl_chunk_list_next function returns an iterator for the object
+*	stored in a chunk list after the object associated with a given
+*	iterator.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_chunk_list_iterator_t CL_API
+cl_chunk_list_next(
+	IN	const cl_chunk_list_iterator_t	iterator )
+{
+	cl_chunk_list_iterator_t	itor;
+
+	CL_ASSERT( iterator.p_hdr );
+
+	itor.p_hdr = iterator.p_hdr;
+	itor.index = iterator.index + 1;
+	if( itor.index >= itor.p_hdr->last )
+	{
+		itor.p_hdr =
+			(const cl_list_chunk_hdr_t*)itor.p_hdr->pool_item.list_item.p_next;
+		itor.index = itor.p_hdr->first;
+	}
+	return( itor );
+}
+/*
+* PARAMETERS
+*	iterator
+*		[in] cl_chunk_list_iterator_t returned by a previous call to
+*		cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next, or
+*		cl_chunk_list_prev.
+*
+* RETURN VALUES
+*	cl_chunk_list_iterator_t for the object following the object associated
+*	with the iterator specified by the iterator parameter.
+*
+*	cl_chunk_list_iterator_t for the end of the list if there is no
+*	following object.
+*
+* NOTES
+*	Within a chunk, the next object is found without touching any memory
+*	but the chunk header.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_prev, cl_chunk_list_head, cl_chunk_list_tail,
+*	cl_chunk_list_end, cl_chunk_list_obj
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_prev
+* NAME
+*	cl_chunk_list_prev
+*
+* DESCRIPTION
+*	The cl_chunk_list_prev function returns an iterator for the object
+*	stored in a chunk list before the object associated with a given
+*	iterator.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_chunk_list_iterator_t CL_API
+cl_chunk_list_prev(
+	IN	const cl_chunk_list_iterator_t	iterator )
+{
+	cl_chunk_list_iterator_t	itor;
+
+	CL_ASSERT( iterator.p_hdr );
+
+	itor.p_hdr = iterator.p_hdr;
+	itor.index = iterator.index;
+	if( itor.index <= itor.p_hdr->first )
+	{
+		itor.p_hdr =
+			(const cl_list_chunk_hdr_t*)itor.p_hdr->pool_item.list_item.p_prev;
+		itor.index = itor.p_hdr->last;
+	}
+	itor.index--;
+	return( itor );
+}
+/*
+* PARAMETERS
+*	iterator
+*		[in] cl_chunk_list_iterator_t returned by a previous call to
+*		cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next, or
+*		cl_chunk_list_prev.
+*
+* RETURN VALUES
+*	cl_chunk_list_iterator_t for the object preceding the object associated
+*	with the iterator specified by the iterator parameter.
+*
+*	cl_chunk_list_iterator_t for the end of the list if there is no
+*	preceding object.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_next, cl_chunk_list_head, cl_chunk_list_tail,
+*	cl_chunk_list_end, cl_chunk_list_obj
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_obj
+* NAME
+*	cl_chunk_list_obj
+*
+* DESCRIPTION
+*	The cl_chunk_list_obj function returns the object associated with a
+*	chunk list iterator.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_chunk_list_obj(
+	IN	const cl_chunk_list_iterator_t	iterator )
+{
+	CL_ASSERT( iterator.p_hdr );
+	CL_ASSERT( iterator.index < CL_CHUNK_LIST_OBJS );
+
+	return( (void*)
+		((const cl_list_chunk_t*)iterator.p_hdr)->p_objects[iterator.index] );
+}
+/*
+* PARAMETERS
+*	iterator
+*		[in] cl_chunk_list_iterator_t returned by a previous call to
+*		cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next, or
+*		cl_chunk_list_prev whose object is requested.
+*
+* RETURN VALUE
+*	Pointer to the object associated with the iterator specified by the
+*	iterator parameter.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_head, cl_chunk_list_tail, cl_chunk_list_next,
+*	cl_chunk_list_prev
+*********/
+
+
+/****f* Component Library: Chunk List/cl_is_object_in_chunk_list
+* NAME
+*	cl_is_object_in_chunk_list
+*
+* DESCRIPTION
+*	The cl_is_object_in_chunk_list function returns whether an object
+*	is stored in a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT boolean_t CL_API
+cl_is_object_in_chunk_list(
+	IN	const cl_chunk_list_t* const	p_list,
+	IN	const void* const				p_object );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure in which to look for the
+*		object.
+*
+*	p_object
+*		[in] Pointer to an object stored in a list.
+*
+* RETURN VALUES
+*	TRUE if p_object was found in the list.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	Chunk List
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_find_from_head
+* NAME
+*	cl_chunk_list_find_from_head
+*
+* DESCRIPTION
+*	The cl_chunk_list_find_from_head function uses a specified function
+*	to search for an object starting from the head of a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_chunk_list_iterator_t CL_API
+cl_chunk_list_find_from_head(
+	IN	const cl_chunk_list_t* const	p_list,
+	IN	cl_pfn_list_find_t				pfn_func,
+	IN	const void* const				context );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure to search.
+*
+*	pfn_func
+*		[in] Function invoked to determine if a match was found.
+*		See the cl_pfn_list_find_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback functions to provide context.
+*
+* RETURN VALUES
+*	Returns the iterator for the object if found.
+*
+*	Returns the iterator for the list end otherwise.
+*
+* NOTES
+*	cl_chunk_list_find_from_head does not remove the found object from
+*	the list.  The iterator for the object is returned when the function
+*	provided by the pfn_func parameter returns CL_SUCCESS.  The function
+*	specified by the pfn_func parameter must not perform any list
+*	operations as these would corrupt the list.
+*
+*	The objects of each chunk are visited with a plain array walk.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_find_from_tail, cl_chunk_list_apply_func,
+*	cl_pfn_list_find_t
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_find_from_tail
+* NAME
+*	cl_chunk_list_find_from_tail
+*
+* DESCRIPTION
+*	The cl_chunk_list_find_from_tail function uses a specified function
+*	to search for an object starting from the tail of a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_chunk_list_iterator_t CL_API
+cl_chunk_list_find_from_tail(
+	IN	const cl_chunk_list_t* const	p_list,
+	IN	cl_pfn_list_find_t				pfn_func,
+	IN	const void* const				context );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure to search.
+*
+*	pfn_func
+*		[in] Function invoked to determine if a match was found.
+*		See the cl_pfn_list_find_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback functions to provide context.
+*
+* RETURN VALUES
+*	Returns the iterator for the object if found.
+*
+*	Returns the iterator for the list end otherwise.
+*
+* NOTES
+*	cl_chunk_list_find_from_tail does not remove the found object from
+*	the list.  The iterator for the object is returned when the function
+*	provided by the pfn_func parameter returns CL_SUCCESS.  The function
+*	specified by the pfn_func parameter must not perform any list
+*	operations as these would corrupt the list.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_find_from_head, cl_chunk_list_apply_func,
+*	cl_pfn_list_find_t
+*********/
+
+
+/****f* Component Library: Chunk List/cl_chunk_list_apply_func
+* NAME
+*	cl_chunk_list_apply_func
+*
+* DESCRIPTION
+*	The cl_chunk_list_apply_func function executes a specified function for
+*	every object stored in a chunk list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_chunk_list_apply_func(
+	IN	const cl_chunk_list_t* const	p_list,
+	IN	cl_pfn_list_apply_t				pfn_func,
+	IN	const void* const				context );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_chunk_list_t structure to iterate.
+*
+*	pfn_func
+*		[in] Function invoked for every item in a list.
+*		See the cl_pfn_list_apply_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback functions to provide context.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	cl_chunk_list_apply_func invokes the specified callback function for
+*	every object stored in the list, starting from the head.  The function
+*	specified by the pfn_func parameter must not perform any list
+*	operations as these would corrupt the list.
+*
+* SEE ALSO
+*	Chunk List, cl_chunk_list_find_from_head, cl_chunk_list_find_from_tail,
+*	cl_pfn_list_apply_t
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#endif /* _CL_CHUNK_LIST_H_ */
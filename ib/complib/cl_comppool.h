@@ -84,7 +84,7 @@
 *		cl_pfn_cpool_init_t, cl_pfn_cpool_dtor_t
 *
 *	Initialization/Destruction:
-*		cl_cpool_construct, cl_cpool_init, cl_cpool_destroy
+*		cl_cpool_construct, cl_cpool_init, cl_cpool_init_ex, cl_cpool_destroy
 *
 *	Manipulation:
 *		cl_cpool_get, cl_cpool_put, cl_cpool_grow
@@ -395,6 +395,48 @@ cl_cpool_init(
 *********/
 
 
+/****f* Component Library: Composite Pool/cl_cpool_init_ex
+* NAME
+*	cl_cpool_init_ex
+*
+* DESCRIPTION
+*	The cl_cpool_init_ex function initializes a composite pool for use, with
+*	an allocation policy.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_cpool_init_ex(
+	IN	cl_cpool_t* const		p_pool,
+	IN	const size_t			min_size,
+	IN	const size_t			max_size,
+	IN	const size_t			grow_size,
+	IN	size_t* const			component_sizes,
+	IN	const uint32_t			num_components,
+	IN	const cl_mem_policy_t* const	p_policy OPTIONAL,
+	IN	cl_pfn_cpool_init_t		pfn_initializer OPTIONAL,
+	IN	cl_pfn_cpool_dtor_t		pfn_destructor OPTIONAL,
+	IN	const void* const		context );
+/*
+* PARAMETERS
+*	p_policy
+*		[in] Allocation policy used whenever the pool grows.  The policy is
+*		copied into the pool.  If NULL, the pool allocates from the system
+*		heap, as with cl_cpool_init.
+*
+*	Other parameters are the same as those of cl_cpool_init.
+*
+* RETURN VALUES
+*	Same as cl_cpool_init.
+*
+*	CL_INSUFFICIENT_MEMORY is also returned if the policy requires large
+*	pages and none are available.
+*
+* SEE ALSO
+*	Composite Pool, cl_cpool_init, cl_mem_policy_t
+*********/
+
+
 /****f* Component Library: Composite Pool/cl_cpool_destroy
 * NAME
 *	cl_cpool_destroy
@@ -0,0 +1,896 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	This file contains contiguous vector definitions.  Contiguous vector
+ *	stores all elements in a single array.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_CVECTOR_H_
+#define _CL_CVECTOR_H_
+
+
+#include <complib/cl_vector.h>
+#include <complib/cl_memory.h>
+
+
+/****h* Component Library/Contiguous Vector
+* NAME
+*	Contiguous Vector
+*
+* DESCRIPTION
+*	The Contiguous Vector is a self-sizing array that stores all of its
+*	elements in a single memory block.
+*
+*	Unlike vector, which allocates elements in separate blocks and reaches
+*	them through an array of pointers, a contiguous vector locates an
+*	element with a single multiply and add.  Sequential scans touch memory
+*	in order, and users can walk the element array directly.
+*
+*	A contiguous vector grows geometrically.  When its capacity is exceeded,
+*	a larger block is allocated and existing elements are moved into it,
+*	which invalidates pointers to elements.  Users that need pointers to
+*	elements to remain valid must set a maximum size at initialization, in
+*	which case the full block is allocated up front and never moved.
+*
+*	Elements are moved with a plain memory copy unless a move callback is
+*	provided, for elements that hold pointers to themselves or are otherwise
+*	not bitwise relocatable.
+*
+*	Contiguous vector uses the same initializer, destructor, apply and find
+*	callbacks as vector.
+*
+*	The cl_cvector_t structure should be treated as opaque and should be
+*	manipulated only through the provided functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_cvector_t
+*
+*	Callbacks:
+*		cl_pfn_vec_init_t, cl_pfn_vec_dtor_t, cl_pfn_vec_apply_t,
+*		cl_pfn_vec_find_t, cl_pfn_cvec_move_t
+*
+*	Initialization:
+*		cl_cvector_construct, cl_cvector_init, cl_cvector_destroy
+*
+*	Manipulation:
+*		cl_cvector_get_capacity, cl_cvector_set_capacity,
+*		cl_cvector_get_size, cl_cvector_set_size, cl_cvector_set_min_size,
+*		cl_cvector_get_ptr, cl_cvector_get_array, cl_cvector_get,
+*		cl_cvector_at, cl_cvector_set
+*
+*	Search:
+*		cl_cvector_find_from_start, cl_cvector_find_from_end,
+*		cl_cvector_apply_func
+*
+* NOTES
+*	Code using vector can be converted by renaming cl_vector_* to
+*	cl_cvector_*, provided it does not keep pointers to elements across
+*	calls that grow the vector, or sets a maximum size.
+*********/
+
+
+/****d* Component Library: Contiguous Vector/cl_pfn_cvec_move_t
+* NAME
+*	cl_pfn_cvec_move_t
+*
+* DESCRIPTION
+*	The cl_pfn_cvec_move_t function type defines the prototype for functions
+*	used to move elements when a contiguous vector relocates its storage.
+*
+* SYNOPSIS
+*/
+typedef void
+(CL_API *cl_pfn_cvec_move_t)(
+	IN	void* const			p_dest,
+	IN	void* const			p_src,
+	IN	void*				context );
+/*
+* PARAMETERS
+*	p_dest
+*		[in] Pointer to the uninitialized storage into which to move the
+*		element.
+*
+*	p_src
+*		[in] Pointer to the element to move.
+*
+*	context
+*		[in] Context provided in a call to cl_cvector_init.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The source storage is released after all elements have been moved.
+*	The destructor is not invoked for the source element.
+*
+*	This function type is provided as function prototype reference for
+*	the move function provided by users as an optional parameter to the
+*	cl_cvector_init function.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_init
+*********/
+
+
+/****s* Component Library: Contiguous Vector/cl_cvector_t
+* NAME
+*	cl_cvector_t
+*
+* DESCRIPTION
+*	Contiguous vector structure.
+*
+*	The cl_cvector_t structure should be treated as opaque and should be
+*	manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_cvector
+{
+	uint8_t				*p_array;
+	size_t				element_size;
+	size_t				size;
+	size_t				capacity;
+	size_t				max_size;
+	cl_pfn_vec_init_t	pfn_init;
+	cl_pfn_vec_dtor_t	pfn_dtor;
+	cl_pfn_cvec_move_t	pfn_move;
+	const void			*context;
+	cl_state_t			state;
+
+} cl_cvector_t;
+/*
+* FIELDS
+*	p_array
+*		Element storage.
+*
+*	element_size
+*		Size of each element.
+*
+*	size
+*		Number of elements successfully initialized in the vector.
+*
+*	capacity
+*		Number of elements the storage can hold.
+*
+*	max_size
+*		Maximum number of elements, or zero if the vector is unbounded.
+*
+*	pfn_init
+*		User supplied element initializer.
+*
+*	pfn_dtor
+*		User supplied element destructor.
+*
+*	pfn_move
+*		User supplied element move function, or NULL to move elements
+*		with a memory copy.
+*
+*	context
+*		User context for callbacks.
+*
+*	state
+*		State of the vector.
+*
+* NOTES
+*	The first two fields are the only ones read by cl_cvector_get_ptr.
+*
+* SEE ALSO
+*	Contiguous Vector
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_construct
+* NAME
+*	cl_cvector_construct
+*
+* DESCRIPTION
+*	The cl_cvector_construct function constructs a contiguous vector.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_cvector_construct(
+	IN	cl_cvector_t* const	p_vector );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_cvector_destroy without first calling cl_cvector_init.
+*
+*	Calling cl_cvector_construct is a prerequisite to calling any other
+*	contiguous vector function except cl_cvector_init.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_init, cl_cvector_destroy
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_init
+* NAME
+*	cl_cvector_init
+*
+* DESCRIPTION
+*	The cl_cvector_init function initializes a contiguous vector for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_cvector_init(
+	IN	cl_cvector_t* const	p_vector,
+	IN	const size_t		min_size,
+	IN	const size_t		max_size,
+	IN	const size_t		element_size,
+	IN	cl_pfn_vec_init_t	pfn_init OPTIONAL,
+	IN	cl_pfn_vec_dtor_t	pfn_dtor OPTIONAL,
+	IN	cl_pfn_cvec_move_t	pfn_move OPTIONAL,
+	IN	const void* const	context );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure to inititalize.
+*
+*	min_size
+*		[in] Initial number of elements.
+*
+*	max_size
+*		[in] Maximum number of elements the vector can hold.  If non-zero,
+*		storage for max_size elements is allocated immediately and is
+*		never moved.  A value of zero lets the vector grow without limit.
+*
+*	element_size
+*		[in] Size of each element.
+*
+*	pfn_init
+*		[in] Initializer callback to invoke for every new element.
+*		See the cl_pfn_vec_init_t function type declaration for details about
+*		the callback function.
+*
+*	pfn_dtor
+*		[in] Destructor callback to invoke for elements being deallocated.
+*		See the cl_pfn_vec_dtor_t function type declaration for details about
+*		the callback function.
+*
+*	pfn_move
+*		[in] Callback to invoke for every element moved when the storage
+*		is relocated.  See the cl_pfn_cvec_move_t function type declaration
+*		for details about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback functions to provide context.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the vector was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if the initialization failed.
+*
+*	CL_INVALID_SETTING if max_size is non-zero and less than min_size.
+*
+*	cl_status_t value returned by optional initializer function specified by
+*	the pfn_init parameter.
+*
+* NOTES
+*	The initializer function, if any, is invoked for every new element in
+*	the array.
+*
+*	Without a maximum size, the capacity at least doubles each time the
+*	vector grows, so that storing n elements one at a time moves each
+*	element a constant number of times on average.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_construct, cl_cvector_destroy,
+*	cl_cvector_set, cl_cvector_get_ptr, cl_pfn_cvec_move_t
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_destroy
+* NAME
+*	cl_cvector_destroy
+*
+* DESCRIPTION
+*	The cl_cvector_destroy function destroys a contiguous vector.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_cvector_destroy(
+	IN	cl_cvector_t* const	p_vector );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	cl_cvector_destroy invokes the destructor, if any, for every element
+*	and frees the element storage.
+*
+*	This function should only be called after a call to
+*	cl_cvector_construct or cl_cvector_init.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_construct, cl_cvector_init
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_get_capacity
+* NAME
+*	cl_cvector_get_capacity
+*
+* DESCRIPTION
+*	The cl_cvector_get_capacity function returns the capacity of a
+*	contiguous vector.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_cvector_get_capacity(
+	IN	const cl_cvector_t* const	p_vector )
+{
+	CL_ASSERT( p_vector );
+	CL_ASSERT( p_vector->state == CL_INITIALIZED );
+
+	return( p_vector->capacity );
+}
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure whose capacity to return.
+*
+* RETURN VALUE
+*	Capacity, in elements, of the vector.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_set_capacity, cl_cvector_get_size
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_get_size
+* NAME
+*	cl_cvector_get_size
+*
+* DESCRIPTION
+*	The cl_cvector_get_size function returns the size of a contiguous
+*	vector.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_cvector_get_size(
+	IN	const cl_cvector_t* const	p_vector )
+{
+	CL_ASSERT( p_vector );
+	CL_ASSERT( p_vector->state == CL_INITIALIZED );
+
+	return( p_vector->size );
+}
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure whose size to return.
+*
+* RETURN VALUE
+*	Size, in elements, of the vector.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_set_size, cl_cvector_get_capacity
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_get_ptr
+* NAME
+*	cl_cvector_get_ptr
+*
+* DESCRIPTION
+*	The cl_cvector_get_ptr function returns a pointer to an element
+*	stored in a contiguous vector at a specified index.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_cvector_get_ptr(
+	IN	const cl_cvector_t* const	p_vector,
+	IN	const size_t				index )
+{
+	CL_ASSERT( p_vector );
+	CL_ASSERT( p_vector->state == CL_INITIALIZED );
+
+	return( p_vector->p_array + index * p_vector->element_size );
+}
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure from which to get a
+*		pointer to an element.
+*
+*	index
+*		[in] Index of the element.
+*
+* RETURN VALUE
+*	Pointer to the element stored at specified index.
+*
+* NOTES
+*	cl_cvector_get_ptr does not perform boundary checking.  Callers are
+*	responsible for providing an index that is within the range of the
+*	vector.
+*
+*	Unless the vector has a maximum size, the returned pointer is only
+*	valid until the next call that grows the vector.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_get_array, cl_cvector_get, cl_cvector_at,
+*	cl_cvector_set
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_get_array
+* NAME
+*	cl_cvector_get_array
+*
+* DESCRIPTION
+*	The cl_cvector_get_array function returns a pointer to the first element
+*	of a contiguous vector.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_cvector_get_array(
+	IN	const cl_cvector_t* const	p_vector )
+{
+	CL_ASSERT( p_vector );
+	CL_ASSERT( p_vector->state == CL_INITIALIZED );
+
+	return( p_vector->p_array );
+}
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure whose elements to access.
+*
+* RETURN VALUE
+*	Pointer to the element array, or NULL if the vector has no storage.
+*
+* NOTES
+*	Elements are stored at a stride of the element size given to
+*	cl_cvector_init, allowing callers to walk them as a C array of
+*	cl_cvector_get_size elements.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_get_ptr, cl_cvector_get_size
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_get
+* NAME
+*	cl_cvector_get
+*
+* DESCRIPTION
+*	The cl_cvector_get function copies an element stored in a contiguous
+*	vector at a specified index.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_cvector_get(
+	IN	const cl_cvector_t* const	p_vector,
+	IN	const size_t				index,
+	OUT	void* const					p_element )
+{
+	CL_ASSERT( p_vector );
+	CL_ASSERT( p_vector->state == CL_INITIALIZED );
+	CL_ASSERT( p_element );
+
+	cl_memcpy( p_element, cl_cvector_get_ptr( p_vector, index ),
+		p_vector->element_size );
+}
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure from which to get a copy of
+*		an element.
+*
+*	index
+*		[in] Index of the element.
+*
+*	p_element
+*		[out] Pointer to storage for the element. Contains a copy of the
+*		desired element upon successful completion of the call.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	cl_cvector_get does not perform boundary checking on the vector, and
+*	callers are responsible for providing an index that is within the range
+*	of the vector.  To access elements after performing boundary checks,
+*	use cl_cvector_at.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_get_ptr, cl_cvector_at
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_at
+* NAME
+*	cl_cvector_at
+*
+* DESCRIPTION
+*	The cl_cvector_at function copies an element stored in a contiguous
+*	vector at a specified index, performing boundary checks.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_status_t CL_API
+cl_cvector_at(
+	IN	const cl_cvector_t* const	p_vector,
+	IN	const size_t				index,
+	OUT	void* const					p_element )
+{
+	CL_ASSERT( p_vector );
+	CL_ASSERT( p_vector->state == CL_INITIALIZED );
+
+	if( index >= p_vector->size )
+		return( CL_INVALID_SETTING );
+
+	cl_cvector_get( p_vector, index, p_element );
+	return( CL_SUCCESS );
+}
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure from which to get a copy of
+*		an element.
+*
+*	index
+*		[in] Index of the element.
+*
+*	p_element
+*		[out] Pointer to storage for the element. Contains a copy of the
+*		desired element upon successful completion of the call.
+*
+* RETURN VALUES
+*	CL_SUCCESS if an element was found at the specified index.
+*
+*	CL_INVALID_SETTING if the index was out of range.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_get, cl_cvector_get_ptr
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_set
+* NAME
+*	cl_cvector_set
+*
+* DESCRIPTION
+*	The cl_cvector_set function sets the element at the specified index.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_cvector_set(
+	IN	cl_cvector_t* const	p_vector,
+	IN	const size_t		index,
+	IN	void* const			p_element );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure into which to store
+*		an element.
+*
+*	index
+*		[in] Index of the element.
+*
+*	p_element
+*		[in] Pointer to an element to store in the vector.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the element was successfully set.
+*
+*	CL_INSUFFICIENT_MEMORY if the vector could not be resized to accommodate
+*	the new element.
+*
+*	CL_INVALID_SETTING if index is not less than a non-zero maximum size.
+*
+* NOTES
+*	cl_cvector_set grows the vector as needed to accommodate the new
+*	element.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_get
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_set_capacity
+* NAME
+*	cl_cvector_set_capacity
+*
+* DESCRIPTION
+*	The cl_cvector_set_capacity function reserves memory in a contiguous
+*	vector for a specified number of elements.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_cvector_set_capacity(
+	IN	cl_cvector_t* const	p_vector,
+	IN	const size_t		new_capacity );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure whose capacity to set.
+*
+*	new_capacity
+*		[in] Total number of elements for which the vector should
+*		allocate memory.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the capacity was successfully set.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to satisfy the
+*	operation.  The vector is left unchanged.
+*
+*	CL_INVALID_SETTING if new_capacity exceeds a non-zero maximum size.
+*
+* NOTES
+*	cl_cvector_set_capacity increases the capacity of the vector to exactly
+*	new_capacity, moving the elements if needed.  Reserving the expected
+*	number of elements up front avoids moving them later.  If the requested
+*	capacity is less than the current capacity, the vector is left
+*	unchanged.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_get_capacity, cl_cvector_set_size,
+*	cl_cvector_set_min_size
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_set_size
+* NAME
+*	cl_cvector_set_size
+*
+* DESCRIPTION
+*	The cl_cvector_set_size function resizes a contiguous vector, either
+*	increasing or decreasing its size.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_cvector_set_size(
+	IN	cl_cvector_t* const	p_vector,
+	IN	const size_t		size );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure whose size to set.
+*
+*	size
+*		[in] Number of elements desired in the vector.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the size of the vector was set successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to complete the
+*	operation.  The vector is left unchanged.
+*
+*	CL_INVALID_SETTING if size exceeds a non-zero maximum size.
+*
+* NOTES
+*	The destructor function, if any, will be invoked for all elements that
+*	are above size.  Likewise, the initializer, if any, will be invoked for
+*	all new elements.  Shrinking the vector does not release storage.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_get_size, cl_cvector_set_min_size,
+*	cl_cvector_set_capacity
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_set_min_size
+* NAME
+*	cl_cvector_set_min_size
+*
+* DESCRIPTION
+*	The cl_cvector_set_min_size function resizes a contiguous vector to a
+*	specified size if the vector is smaller than the specified size.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_cvector_set_min_size(
+	IN	cl_cvector_t* const	p_vector,
+	IN	const size_t		min_size );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure whose minimum size to set.
+*
+*	min_size
+*		[in] Minimum number of elements that the vector should contain.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the vector size is greater than or equal to min_size.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to resize the
+*	vector.  The vector is left unchanged.
+*
+*	CL_INVALID_SETTING if min_size exceeds a non-zero maximum size.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_get_size, cl_cvector_set_size,
+*	cl_cvector_set_capacity
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_apply_func
+* NAME
+*	cl_cvector_apply_func
+*
+* DESCRIPTION
+*	The cl_cvector_apply_func function invokes a specified function for
+*	every element in a contiguous vector.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_cvector_apply_func(
+	IN	const cl_cvector_t* const	p_vector,
+	IN	cl_pfn_vec_apply_t			pfn_callback,
+	IN	const void* const			context );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure whose elements to iterate.
+*
+*	pfn_callback
+*		[in] Function invoked for every element in the array.
+*		See the cl_pfn_vec_apply_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback function.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	cl_cvector_apply_func invokes the specified function for every element
+*	in the vector, starting from the beginning of the vector and advancing
+*	through the element array by the element size.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_find_from_start, cl_cvector_find_from_end,
+*	cl_pfn_vec_apply_t
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_find_from_start
+* NAME
+*	cl_cvector_find_from_start
+*
+* DESCRIPTION
+*	The cl_cvector_find_from_start function uses a specified function to
+*	search for elements in a contiguous vector starting from the lowest
+*	index.
+*
+* SYNOPSIS
+*/
+CL_EXPORT size_t CL_API
+cl_cvector_find_from_start(
+	IN	const cl_cvector_t* const	p_vector,
+	IN	cl_pfn_vec_find_t			pfn_callback,
+	IN	const void* const			context );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure to search.
+*
+*	pfn_callback
+*		[in] Function invoked to determine if a match was found.
+*		See the cl_pfn_vec_find_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback function.
+*
+* RETURN VALUES
+*	Index of the element, if found.
+*
+*	Size of the vector if the element was not found.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_find_from_end, cl_cvector_apply_func,
+*	cl_pfn_vec_find_t
+*********/
+
+
+/****f* Component Library: Contiguous Vector/cl_cvector_find_from_end
+* NAME
+*	cl_cvector_find_from_end
+*
+* DESCRIPTION
+*	The cl_cvector_find_from_end function uses a specified function to
+*	search for elements in a contiguous vector starting from the highest
+*	index.
+*
+* SYNOPSIS
+*/
+CL_EXPORT size_t CL_API
+cl_cvector_find_from_end(
+	IN	const cl_cvector_t* const	p_vector,
+	IN	cl_pfn_vec_find_t			pfn_callback,
+	IN	const void* const			context );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_cvector_t structure to search.
+*
+*	pfn_callback
+*		[in] Function invoked to determine if a match was found.
+*		See the cl_pfn_vec_find_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback function.
+*
+* RETURN VALUES
+*	Index of the element, if found.
+*
+*	Size of the vector if the element was not found.
+*
+* SEE ALSO
+*	Contiguous Vector, cl_cvector_find_from_start, cl_cvector_apply_func,
+*	cl_pfn_vec_find_t
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+
+#endif	/* _CL_CVECTOR_H_ */
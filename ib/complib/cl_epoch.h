@@ -0,0 +1,615 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of epoch based memory reclamation, which allows readers
+ *	of shared data structures to run without taking locks.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_EPOCH_H_
+#define _CL_EPOCH_H_
+
+
+#include <complib/cl_atomic.h>
+#include <complib/cl_qlist.h>
+#include <complib/cl_spinlock.h>
+
+
+/****h* Component Library/Epoch
+* NAME
+*	Epoch
+*
+* DESCRIPTION
+*	Epoch based reclamation lets readers traverse a shared structure
+*	without locks while writers replace parts of it.  Writers unlink an
+*	object so that no new reader can find it, then retire it to the epoch.
+*	A retired object is freed only once every reader that might still hold
+*	a reference to it has left its read side critical section.
+*
+*	Each reading thread owns a cl_epoch_reader_t, registered once with the
+*	epoch.  Entering and leaving a read side critical section is a single
+*	store to that thread's own cache line; readers never write shared data,
+*	so read throughput scales with the number of processors.
+*
+*	The global epoch advances once every active reader has observed its
+*	current value.  Objects retired during epoch E are freed when the global
+*	epoch reaches E + 2.
+*
+*	Read side critical sections must be short and must not block, since a
+*	reader that stays inside one delays all reclamation.
+*
+*	The epoch functions operate on a cl_epoch_t structure which should be
+*	treated as opaque and should be manipulated only through the provided
+*	functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_epoch_t, cl_epoch_reader_t, cl_epoch_item_t
+*
+*	Callbacks:
+*		cl_pfn_epoch_free_t
+*
+*	Initialization:
+*		cl_epoch_construct, cl_epoch_init, cl_epoch_destroy
+*
+*	Readers:
+*		cl_epoch_reader_register, cl_epoch_reader_deregister,
+*		cl_epoch_enter, cl_epoch_leave
+*
+*	Writers:
+*		cl_epoch_retire, cl_epoch_reclaim, cl_epoch_synchronize
+*********/
+
+
+/****s* Component Library: Epoch/cl_epoch_reader_t
+* NAME
+*	cl_epoch_reader_t
+*
+* DESCRIPTION
+*	Per thread reader state.
+*
+*	The cl_epoch_reader_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_epoch_reader
+{
+	atomic32_t				epoch;
+	cl_list_item_t			list_item;
+	uint8_t					pad[CL_CACHE_LINE_SIZE - sizeof(atomic32_t) -
+								sizeof(cl_list_item_t)];
+
+} cl_epoch_reader_t;
+/*
+* FIELDS
+*	epoch
+*		Global epoch observed when the reader entered its critical section,
+*		or zero when the reader is quiescent.
+*
+*	list_item
+*		Used to link the reader into the epoch's list of readers.
+*
+*	pad
+*		Pads the structure to a full cache line so that readers of different
+*		threads never share a line.
+*
+* NOTES
+*	A reader must be used by a single thread at a time.  Allocate readers
+*	on a cache line boundary for full benefit.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_reader_register, cl_epoch_enter, cl_epoch_leave
+*********/
+
+
+/****d* Component Library: Epoch/cl_pfn_epoch_free_t
+* NAME
+*	cl_pfn_epoch_free_t
+*
+* DESCRIPTION
+*	The cl_pfn_epoch_free_t function type defines the prototype for
+*	functions used to free retired objects.
+*
+* SYNOPSIS
+*/
+struct _cl_epoch_item;
+
+typedef void
+(CL_API *cl_pfn_epoch_free_t)(
+	IN	struct _cl_epoch_item* const	p_item );
+/*
+* PARAMETERS
+*	p_item
+*		[in] Pointer to the cl_epoch_item_t that was passed to
+*		cl_epoch_retire.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The callback is invoked from cl_epoch_retire, cl_epoch_reclaim,
+*	cl_epoch_synchronize or cl_epoch_destroy in the context of the writer.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_retire
+*********/
+
+
+/****s* Component Library: Epoch/cl_epoch_item_t
+* NAME
+*	cl_epoch_item_t
+*
+* DESCRIPTION
+*	The cl_epoch_item_t structure is embedded in objects that are retired
+*	to an epoch.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_epoch_item
+{
+	cl_list_item_t			list_item;
+	cl_pfn_epoch_free_t		pfn_free;
+	uint32_t				epoch;
+
+} cl_epoch_item_t;
+/*
+* FIELDS
+*	list_item
+*		Used to queue the item until it can be freed.
+*
+*	pfn_free
+*		Function invoked to free the object once no reader can reference it.
+*
+*	epoch
+*		Global epoch at the time the item was retired.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_retire
+*********/
+
+
+/****s* Component Library: Epoch/cl_epoch_t
+* NAME
+*	cl_epoch_t
+*
+* DESCRIPTION
+*	Epoch structure.
+*
+*	The cl_epoch_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_epoch
+{
+	atomic32_t				global_epoch;
+	uint8_t					pad[CL_CACHE_LINE_SIZE - sizeof(atomic32_t)];
+	cl_spinlock_t			lock;
+	cl_qlist_t				reader_list;
+	cl_qlist_t				retire_list;
+	cl_state_t				state;
+
+} cl_epoch_t;
+/*
+* FIELDS
+*	global_epoch
+*		Current global epoch.  Never zero: the epoch is advanced with
+*		__cl_epoch_next, which wraps from 0xFFFFFFFF to 1, since zero marks
+*		a quiescent reader.
+*
+*	pad
+*		Keeps the global epoch, which every reader loads, on a cache line of
+*		its own.
+*
+*	lock
+*		Serializes writers, reader registration and reclamation.
+*
+*	reader_list
+*		List of registered readers.
+*
+*	retire_list
+*		Retired items waiting to be freed, oldest first.
+*
+*	state
+*		State of the epoch.
+*
+* SEE ALSO
+*	Epoch
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Epoch/cl_epoch_construct
+* NAME
+*	cl_epoch_construct
+*
+* DESCRIPTION
+*	The cl_epoch_construct function constructs an epoch.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_epoch_construct(
+	IN	cl_epoch_t* const	p_epoch );
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to a cl_epoch_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_epoch_destroy without first calling cl_epoch_init.
+*
+*	Calling cl_epoch_construct is a prerequisite to calling any other
+*	epoch function except cl_epoch_init.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_init, cl_epoch_destroy
+*********/
+
+
+/****f* Component Library: Epoch/cl_epoch_init
+* NAME
+*	cl_epoch_init
+*
+* DESCRIPTION
+*	The cl_epoch_init function initializes an epoch for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_epoch_init(
+	IN	cl_epoch_t* const	p_epoch );
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to a cl_epoch_t structure to initialize.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the epoch was initialized successfully.
+*
+*	CL_ERROR if the lock could not be initialized.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_construct, cl_epoch_destroy
+*********/
+
+
+/****f* Component Library: Epoch/cl_epoch_destroy
+* NAME
+*	cl_epoch_destroy
+*
+* DESCRIPTION
+*	The cl_epoch_destroy function frees all retired items and destroys
+*	an epoch.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_epoch_destroy(
+	IN	cl_epoch_t* const	p_epoch );
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to a cl_epoch_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	All readers must have been deregistered.  Items still waiting to be
+*	reclaimed are freed immediately.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_construct, cl_epoch_init
+*********/
+
+
+/****f* Component Library: Epoch/cl_epoch_reader_register
+* NAME
+*	cl_epoch_reader_register
+*
+* DESCRIPTION
+*	The cl_epoch_reader_register function registers a thread's reader state
+*	with an epoch.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_epoch_reader_register(
+	IN	cl_epoch_t* const			p_epoch,
+	IN	cl_epoch_reader_t* const	p_reader );
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to an epoch.
+*
+*	p_reader
+*		[in] Pointer to the reader state to register.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_reader_deregister, cl_epoch_enter
+*********/
+
+
+/****f* Component Library: Epoch/cl_epoch_reader_deregister
+* NAME
+*	cl_epoch_reader_deregister
+*
+* DESCRIPTION
+*	The cl_epoch_reader_deregister function removes a thread's reader state
+*	from an epoch.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_epoch_reader_deregister(
+	IN	cl_epoch_t* const			p_epoch,
+	IN	cl_epoch_reader_t* const	p_reader );
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to an epoch.
+*
+*	p_reader
+*		[in] Pointer to the reader state to deregister.  The reader must not
+*		be inside a read side critical section.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_reader_register
+*********/
+
+
+/*
+ * Returns the epoch following an epoch, skipping zero when the counter wraps.
+ * Retired items compare epochs only for equality, so wrapping is harmless.
+ */
+CL_INLINE uint32_t CL_API
+__cl_epoch_next(
+	IN	const uint32_t	epoch )
+{
+	return( (epoch == 0xFFFFFFFF) ? 1 : epoch + 1 );
+}
+
+
+/****f* Component Library: Epoch/cl_epoch_enter
+* NAME
+*	cl_epoch_enter
+*
+* DESCRIPTION
+*	The cl_epoch_enter function begins a read side critical section.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_epoch_enter(
+	IN	cl_epoch_t* const			p_epoch,
+	IN	cl_epoch_reader_t* const	p_reader )
+{
+	CL_ASSERT( p_epoch );
+	CL_ASSERT( p_epoch->state == CL_INITIALIZED );
+	CL_ASSERT( p_reader );
+	CL_ASSERT( !p_reader->epoch );
+	CL_ASSERT( p_epoch->global_epoch );
+
+	/*
+	 * The exchange is a full barrier, so the epoch is published before any
+	 * shared pointer is loaded inside the critical section.
+	 */
+	cl_atomic_xchg( &p_reader->epoch, p_epoch->global_epoch );
+}
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to an epoch.
+*
+*	p_reader
+*		[in] Pointer to the calling thread's registered reader state.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Pointers to shared objects loaded after cl_epoch_enter remain valid
+*	until the matching call to cl_epoch_leave.  Critical sections do not
+*	nest.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_leave
+*********/
+
+
+/****f* Component Library: Epoch/cl_epoch_leave
+* NAME
+*	cl_epoch_leave
+*
+* DESCRIPTION
+*	The cl_epoch_leave function ends a read side critical section.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_epoch_leave(
+	IN	cl_epoch_t* const			p_epoch,
+	IN	cl_epoch_reader_t* const	p_reader )
+{
+	CL_ASSERT( p_epoch );
+	CL_ASSERT( p_reader );
+	CL_ASSERT( p_reader->epoch );
+	UNUSED_PARAM( p_epoch );
+
+	/* All loads of the critical section complete before going quiescent. */
+	cl_atomic_xchg( &p_reader->epoch, 0 );
+}
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to an epoch.
+*
+*	p_reader
+*		[in] Pointer to the reader state passed to cl_epoch_enter.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_enter
+*********/
+
+
+/****f* Component Library: Epoch/cl_epoch_retire
+* NAME
+*	cl_epoch_retire
+*
+* DESCRIPTION
+*	The cl_epoch_retire function defers freeing an unlinked object until
+*	no reader can reference it.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_epoch_retire(
+	IN	cl_epoch_t* const		p_epoch,
+	IN	cl_epoch_item_t* const	p_item,
+	IN	cl_pfn_epoch_free_t		pfn_free );
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to an epoch.
+*
+*	p_item
+*		[in] Pointer to the cl_epoch_item_t embedded in the retired object.
+*
+*	pfn_free
+*		[in] Function to invoke to free the object.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The object must already be unreachable for new readers.
+*
+*	cl_epoch_retire attempts to advance the global epoch and frees any items
+*	whose grace period has expired, so pfn_free may be invoked for other
+*	items before cl_epoch_retire returns.  It never waits for readers.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_reclaim, cl_epoch_synchronize, cl_pfn_epoch_free_t
+*********/
+
+
+/****f* Component Library: Epoch/cl_epoch_reclaim
+* NAME
+*	cl_epoch_reclaim
+*
+* DESCRIPTION
+*	The cl_epoch_reclaim function attempts to advance the global epoch and
+*	frees retired items whose grace period has expired.
+*
+* SYNOPSIS
+*/
+CL_EXPORT size_t CL_API
+cl_epoch_reclaim(
+	IN	cl_epoch_t* const	p_epoch );
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to an epoch.
+*
+* RETURN VALUE
+*	Returns the number of retired items still waiting to be freed.
+*
+* NOTES
+*	cl_epoch_reclaim never waits for readers.
+*
+*	The global epoch advances with __cl_epoch_next, so it never becomes
+*	zero, the value of a quiescent reader.  An item retired during epoch E
+*	is freed once the global epoch is neither E nor the epoch following E,
+*	which remains correct when the epoch wraps.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_retire, cl_epoch_synchronize
+*********/
+
+
+/****f* Component Library: Epoch/cl_epoch_synchronize
+* NAME
+*	cl_epoch_synchronize
+*
+* DESCRIPTION
+*	The cl_epoch_synchronize function waits until every reader that was
+*	inside a read side critical section at the time of the call has left it,
+*	then frees all retired items.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_epoch_synchronize(
+	IN	cl_epoch_t* const	p_epoch );
+/*
+* PARAMETERS
+*	p_epoch
+*		[in] Pointer to an epoch.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	cl_epoch_synchronize yields the processor while waiting and must be
+*	called at passive level.  It must not be called from inside a read
+*	side critical section.
+*
+* SEE ALSO
+*	Epoch, cl_epoch_retire, cl_epoch_reclaim
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#endif /* _CL_EPOCH_H_ */
@@ -70,7 +70,8 @@ BEGIN_C_DECLS
 *	in minimizing the error paths in code.
 *
 *	Flexi map is not thread safe, and users must provide serialization when
-*	adding and removing items from the map.
+*	adding and removing items from the map.  Read Mostly Flexi Map provides
+*	lock free lookups for maps that rarely change.
 *
 *	The flexi map functions operate on a cl_fmap_t structure which should
 *	be treated as opaque and should be manipulated only through the provided
@@ -97,7 +98,11 @@ BEGIN_C_DECLS
 *		cl_fmap_remove_all, cl_fmap_merge, cl_fmap_delta, cl_fmap_get_next
 *
 *	Search:
-*		cl_fmap_apply_func
+*		cl_fmap_apply_func, cl_fmap_lower_bound, cl_fmap_upper_bound,
+*		cl_fmap_equal_range
+*
+*	Range Iteration:
+*		cl_fmap_range_t, cl_fmap_range_init, cl_fmap_range_next
 *
 *	Attributes:
 *		cl_fmap_count, cl_is_fmap_empty,
@@ -256,6 +261,44 @@ typedef struct _cl_fmap
 *	Flexi Map, cl_pfn_fmap_cmp_t
 *********/
 
+/****s* Component Library: Flexi Map/cl_fmap_range_t
+* NAME
+*	cl_fmap_range_t
+*
+* DESCRIPTION
+*	Iterator over the items of a flexi map whose keys fall in a range.
+*
+*	The cl_fmap_range_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_fmap_range
+{
+	const cl_fmap_t			*p_map;
+	cl_fmap_item_t			*p_item;
+	const void				*p_high;
+	cl_pfn_fmap_cmp_t		pfn_compare;
+
+} cl_fmap_range_t;
+/*
+* FIELDS
+*	p_map
+*		Map being iterated.
+*
+*	p_item
+*		Next item to return.
+*
+*	p_high
+*		Highest key included in the range.
+*
+*	pfn_compare
+*		Compare function used to test items against p_high.
+*
+* SEE ALSO
+*	Flexi Map, cl_fmap_range_init, cl_fmap_range_next
+*********/
+
 /****d* Component Library: Flexi Map/cl_pfn_fmap_apply_t
 * NAME
 *	cl_pfn_fmap_apply_t
@@ -757,6 +800,256 @@ cl_fmap_get_next(
 *	Flexi Map, cl_fmap_remove, cl_fmap_get
 *********/
 
+/****f* Component Library: Flexi Map/cl_fmap_lower_bound
+* NAME
+*	cl_fmap_lower_bound
+*
+* DESCRIPTION
+*	The cl_fmap_lower_bound function returns the first map item whose key
+*	is not less than a specified key.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_fmap_item_t* CL_API
+cl_fmap_lower_bound(
+	IN	const cl_fmap_t* const	p_map,
+	IN	const void* const		p_key,
+	IN	cl_pfn_fmap_cmp_t		pfn_compare OPTIONAL );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_fmap_t structure to search.
+*
+*	p_key
+*		[in] Pointer to a key value to search for.
+*
+*	pfn_compare
+*		[in] Compare function to use instead of the map's own, as for
+*		cl_fmap_match.  The function must order items consistently with the
+*		map's compare function, but may report keys as equal at a coarser
+*		granularity, for instance when only a prefix matters.  Passing NULL
+*		uses the map's compare function.
+*
+* RETURN VALUES
+*	Pointer to the first map item whose key does not compare lower than
+*	p_key.
+*
+*	Pointer to the map end if every key in the map compares lower.
+*
+* NOTES
+*	The search descends the tree once, discarding every subtree that lies
+*	entirely below p_key.
+*
+* SEE ALSO
+*	Flexi Map, cl_fmap_upper_bound, cl_fmap_equal_range, cl_fmap_get_next
+*********/
+
+/****f* Component Library: Flexi Map/cl_fmap_upper_bound
+* NAME
+*	cl_fmap_upper_bound
+*
+* DESCRIPTION
+*	The cl_fmap_upper_bound function returns the first map item whose key
+*	compares greater than a specified key.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_fmap_item_t* CL_API
+cl_fmap_upper_bound(
+	IN	const cl_fmap_t* const	p_map,
+	IN	const void* const		p_key,
+	IN	cl_pfn_fmap_cmp_t		pfn_compare OPTIONAL );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_fmap_t structure to search.
+*
+*	p_key
+*		[in] Pointer to a key value to search for.
+*
+*	pfn_compare
+*		[in] Compare function to use instead of the map's own, with the
+*		same requirements as for cl_fmap_lower_bound.  Passing NULL uses
+*		the map's compare function.
+*
+* RETURN VALUES
+*	Pointer to the first map item whose key compares greater than p_key.
+*
+*	Pointer to the map end if no key in the map compares greater.
+*
+* NOTES
+*	With a NULL pfn_compare, cl_fmap_upper_bound is equivalent to
+*	cl_fmap_get_next.
+*
+* SEE ALSO
+*	Flexi Map, cl_fmap_lower_bound, cl_fmap_equal_range
+*********/
+
+/****f* Component Library: Flexi Map/cl_fmap_equal_range
+* NAME
+*	cl_fmap_equal_range
+*
+* DESCRIPTION
+*	The cl_fmap_equal_range function returns the bounds of the items in a
+*	flexi map whose keys compare equal to a specified key.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_fmap_equal_range(
+	IN	const cl_fmap_t* const		p_map,
+	IN	const void* const			p_key,
+	IN	cl_pfn_fmap_cmp_t			pfn_compare OPTIONAL,
+	OUT	cl_fmap_item_t** const		pp_first,
+	OUT	cl_fmap_item_t** const		pp_end )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( pp_first );
+	CL_ASSERT( pp_end );
+
+	*pp_first = cl_fmap_lower_bound( p_map, p_key, pfn_compare );
+	*pp_end = cl_fmap_upper_bound( p_map, p_key, pfn_compare );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_fmap_t structure to search.
+*
+*	p_key
+*		[in] Pointer to a key value to search for.
+*
+*	pfn_compare
+*		[in] Compare function to use instead of the map's own.  Passing
+*		NULL uses the map's compare function, which yields at most one item.
+*
+*	pp_first
+*		[out] First item in the range, or the item at pp_end if the range
+*		is empty.
+*
+*	pp_end
+*		[out] First item past the range, which may be the map end.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Prefix queries are expressed with a compare function that only compares
+*	the prefix: all GIDs starting with a subnet prefix, for example, are
+*	returned by passing that prefix and a compare function limited to the
+*	upper 64 bits of the GID.
+*
+*	Walk the range with cl_fmap_next until reaching *pp_end.  The bounds
+*	are invalidated by any insertion or removal.
+*
+* SEE ALSO
+*	Flexi Map, cl_fmap_lower_bound, cl_fmap_upper_bound, cl_fmap_range_init
+*********/
+
+/****f* Component Library: Flexi Map/cl_fmap_range_init
+* NAME
+*	cl_fmap_range_init
+*
+* DESCRIPTION
+*	The cl_fmap_range_init function positions a range iterator on the first
+*	item of a flexi map whose key lies in an inclusive range.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_fmap_range_init(
+	OUT	cl_fmap_range_t* const	p_range,
+	IN	const cl_fmap_t* const	p_map,
+	IN	const void* const		p_low,
+	IN	const void* const		p_high,
+	IN	cl_pfn_fmap_cmp_t		pfn_compare OPTIONAL )
+{
+	CL_ASSERT( p_range );
+	CL_ASSERT( p_map );
+
+	p_range->p_map = p_map;
+	p_range->pfn_compare = pfn_compare ? pfn_compare : p_map->pfn_compare;
+	p_range->p_item = cl_fmap_lower_bound( p_map, p_low, pfn_compare );
+	p_range->p_high = p_high;
+}
+/*
+* PARAMETERS
+*	p_range
+*		[out] Pointer to a cl_fmap_range_t structure to initialize.
+*
+*	p_map
+*		[in] Pointer to the cl_fmap_t structure to iterate.
+*
+*	p_low
+*		[in] Pointer to the lowest key of the range.
+*
+*	p_high
+*		[in] Pointer to the highest key of the range.  The key must remain
+*		valid for the life of the iterator.
+*
+*	pfn_compare
+*		[in] Compare function to use instead of the map's own, with the
+*		same requirements as for cl_fmap_lower_bound.  Passing NULL uses
+*		the map's compare function.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Positioning costs one O(log n) descent that skips every subtree below
+*	p_low.  Each following item is reached through the map's ordered list
+*	and iteration stops at the first key above p_high.
+*
+* SEE ALSO
+*	Flexi Map, cl_fmap_range_t, cl_fmap_range_next
+*********/
+
+/****f* Component Library: Flexi Map/cl_fmap_range_next
+* NAME
+*	cl_fmap_range_next
+*
+* DESCRIPTION
+*	The cl_fmap_range_next function returns the next item of a range
+*	iteration.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_fmap_item_t* CL_API
+cl_fmap_range_next(
+	IN OUT	cl_fmap_range_t* const	p_range )
+{
+	cl_fmap_item_t	*p_item;
+
+	CL_ASSERT( p_range );
+
+	p_item = p_range->p_item;
+	if( p_item == cl_fmap_end( p_range->p_map ) ||
+		p_range->pfn_compare( p_item->p_key, p_range->p_high ) > 0 )
+	{
+		return( NULL );
+	}
+
+	p_range->p_item = cl_fmap_next( p_item );
+	return( p_item );
+}
+/*
+* PARAMETERS
+*	p_range
+*		[in/out] Pointer to a range iterator initialized by
+*		cl_fmap_range_init.
+*
+* RETURN VALUES
+*	Pointer to the next map item in the range, in ascending key order.
+*
+*	NULL once all items in the range have been returned.
+*
+* NOTES
+*	The returned item may be removed from the map before the next call.
+*	Any other insertion or removal invalidates the iterator.
+*
+* SEE ALSO
+*	Flexi Map, cl_fmap_range_t, cl_fmap_range_init
+*********/
+
 /****f* Component Library: Flexi Map/cl_fmap_remove_item
 * NAME
 *	cl_fmap_remove_item
@@ -0,0 +1,504 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of hash map, an open addressing hash table of user objects.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_HMAP_H_
+#define _CL_HMAP_H_
+
+
+#include <complib/cl_qhmap.h>
+#include <complib/cl_qpool.h>
+
+
+/****h* Component Library/Hash Map
+* NAME
+*	Hash Map
+*
+* DESCRIPTION
+*	Hash map stores user objects in a hash table indexed by a unique 64-bit
+*	key (duplicates are not allowed).  Hash map provides constant time
+*	point lookups, and is intended for users of map that never need to
+*	visit their objects in key order, such as GUID to name tables and
+*	handle to object tables.
+*
+*	Hash map is built on quick hash map, and allocates the items used to
+*	store objects from an internal pool.  It may therefore fail operations
+*	due to insufficient memory.
+*
+*	Hash map is not thread safe, and users must provide serialization when
+*	adding and removing items from the map.
+*
+*	The hash map functions operate on a cl_hmap_t structure which should be
+*	treated as opaque and should be manipulated only through the provided
+*	functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_hmap_t, cl_hmap_obj_t
+*
+*	Initialization:
+*		cl_hmap_construct, cl_hmap_init, cl_hmap_destroy
+*
+*	Manipulation:
+*		cl_hmap_insert, cl_hmap_get, cl_hmap_remove, cl_hmap_remove_all
+*
+*	Attributes:
+*		cl_hmap_count, cl_is_hmap_empty, cl_is_hmap_inited
+*********/
+
+
+/****s* Component Library: Hash Map/cl_hmap_obj_t
+* NAME
+*	cl_hmap_obj_t
+*
+* DESCRIPTION
+*	The cl_hmap_obj_t structure is used to store objects in hash maps.
+*
+*	The cl_hmap_obj_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_hmap_obj
+{
+	cl_hmap_item_t			item;
+	const void				*p_object;
+
+} cl_hmap_obj_t;
+/*
+* FIELDS
+*	item
+*		Map item used internally by the map to store an object.  Since the
+*		item starts with a cl_pool_item_t, objects are allocated from the
+*		map's quick pool, and objects returned by the pool are recovered
+*		with PARENT_STRUCT( p_pool_item, cl_hmap_obj_t, item.pool_item ).
+*
+*	p_object
+*		User defined context.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_item_t
+*********/
+
+
+/****s* Component Library: Hash Map/cl_hmap_t
+* NAME
+*	cl_hmap_t
+*
+* DESCRIPTION
+*	Hash map structure.
+*
+*	The cl_hmap_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_hmap
+{
+	cl_qhmap_t	qhmap;
+	cl_qpool_t	pool;
+
+} cl_hmap_t;
+/*
+* FIELDS
+*	qhmap
+*		Quick hash map object that maintains the map.
+*
+*	pool
+*		Pool of cl_hmap_obj_t structures used to store user objects
+*		in the map.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_obj_t
+*********/
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/****f* Component Library: Hash Map/cl_hmap_count
+* NAME
+*	cl_hmap_count
+*
+* DESCRIPTION
+*	The cl_hmap_count function returns the number of items stored
+*	in a hash map.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_hmap_count(
+	IN	const cl_hmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	return( cl_qhmap_count( &p_map->qhmap ) );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a hash map whose item count to return.
+*
+* RETURN VALUE
+*	Returns the number of items stored in the map.
+*
+* SEE ALSO
+*	Hash Map, cl_is_hmap_empty
+*********/
+
+
+/****f* Component Library: Hash Map/cl_is_hmap_empty
+* NAME
+*	cl_is_hmap_empty
+*
+* DESCRIPTION
+*	The cl_is_hmap_empty function returns whether a hash map is empty.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_hmap_empty(
+	IN	const cl_hmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	return( cl_is_qhmap_empty( &p_map->qhmap ) );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a hash map to test for emptiness.
+*
+* RETURN VALUES
+*	TRUE if the map is empty.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_count, cl_hmap_remove_all
+*********/
+
+
+/****f* Component Library: Hash Map/cl_hmap_construct
+* NAME
+*	cl_hmap_construct
+*
+* DESCRIPTION
+*	The cl_hmap_construct function constructs a hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_hmap_construct(
+	IN	cl_hmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_hmap_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_hmap_init, cl_hmap_destroy, and cl_is_hmap_inited.
+*
+*	Calling cl_hmap_construct is a prerequisite to calling any other
+*	hash map function except cl_hmap_init.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_init, cl_hmap_destroy, cl_is_hmap_inited
+*********/
+
+
+/****f* Component Library: Hash Map/cl_is_hmap_inited
+* NAME
+*	cl_is_hmap_inited
+*
+* DESCRIPTION
+*	The cl_is_hmap_inited function returns whether a hash map was
+*	successfully initialized.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_hmap_inited(
+	IN	const cl_hmap_t* const	p_map )
+{
+	/*
+	 * The map's pool of map items is the last thing initialized.
+	 * We can therefore use it to test for initialization.
+	 */
+	return( cl_is_qpool_inited( &p_map->pool ) );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_hmap_t structure whose initialization state
+*		to check.
+*
+* RETURN VALUES
+*	TRUE if the map was initialized successfully.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	Hash Map
+*********/
+
+
+/****f* Component Library: Hash Map/cl_hmap_init
+* NAME
+*	cl_hmap_init
+*
+* DESCRIPTION
+*	The cl_hmap_init function initializes a hash map for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_hmap_init(
+	IN	cl_hmap_t* const	p_map,
+	IN	const size_t		min_items );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_hmap_t structure to initialize.
+*
+*	min_items
+*		[in] Minimum number of items that can be stored.  All necessary
+*		allocations to allow storing the minimum number of items is performed
+*		at initialization time.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the map was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to initialize
+*	the map.
+*
+* NOTES
+*	Allows calling hash map manipulation functions.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_destroy, cl_hmap_insert, cl_hmap_remove
+*********/
+
+
+/****f* Component Library: Hash Map/cl_hmap_destroy
+* NAME
+*	cl_hmap_destroy
+*
+* DESCRIPTION
+*	The cl_hmap_destroy function destroys a hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_hmap_destroy(
+	IN	cl_hmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a hash map to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Performs any necessary cleanup of the specified map. Further
+*	operations should not be attempted on the map. cl_hmap_destroy does
+*	not affect any of the objects stored in the map.
+*	This function should only be called after a call to cl_hmap_construct.
+*
+*	In debug builds, cl_hmap_destroy asserts that the map is empty.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_construct, cl_hmap_init
+*********/
+
+
+/****f* Component Library: Hash Map/cl_hmap_insert
+* NAME
+*	cl_hmap_insert
+*
+* DESCRIPTION
+*	The cl_hmap_insert function inserts an object into a hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+cl_hmap_insert(
+	IN	cl_hmap_t* const	p_map,
+	IN	const uint64_t		key,
+	IN	const void* const	p_object );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a hash map into which to add the item.
+*
+*	key
+*		[in] Value to associate with the object.
+*
+*	p_object
+*		[in] Pointer to an object to insert into the map.
+*
+* RETURN VALUES
+*	Pointer to the object in the map with the specified key after the call
+*	completes.
+*
+*	NULL if there was not enough memory to insert the desired item.
+*
+* NOTES
+*	If the map already contains an object already with the specified key,
+*	that object will not be replaced and the pointer to that object is
+*	returned.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_remove, cl_qhmap_insert
+*********/
+
+
+/****f* Component Library: Hash Map/cl_hmap_get
+* NAME
+*	cl_hmap_get
+*
+* DESCRIPTION
+*	The cl_hmap_get function returns the object associated with a key.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_hmap_get(
+	IN	const cl_hmap_t* const	p_map,
+	IN	const uint64_t			key )
+{
+	cl_hmap_item_t	*p_item;
+
+	CL_ASSERT( p_map );
+
+	p_item = cl_qhmap_get( &p_map->qhmap, key );
+	if( !p_item )
+		return( NULL );
+
+	return( (void*)PARENT_STRUCT( p_item, cl_hmap_obj_t, item )->p_object );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a hash map from which to retrieve the object with
+*		the specified key.
+*
+*	key
+*		[in] Key value used to search for the desired object.
+*
+* RETURN VALUES
+*	Pointer to the object with the desired key value.
+*
+*	NULL if there was no item with the desired key value stored in
+*	the map.
+*
+* NOTES
+*	cl_hmap_get does not remove the item from the map.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_remove
+*********/
+
+
+/****f* Component Library: Hash Map/cl_hmap_remove
+* NAME
+*	cl_hmap_remove
+*
+* DESCRIPTION
+*	The cl_hmap_remove function removes the object with the specified key
+*	from a hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+cl_hmap_remove(
+	IN	cl_hmap_t* const	p_map,
+	IN	const uint64_t		key );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_hmap_t structure from which to remove the item
+*		with the specified key.
+*
+*	key
+*		[in] Key value used to search for the object to remove.
+*
+* RETURN VALUES
+*	Pointer to the object associated with the specified key if
+*	it was found and removed.
+*
+*	NULL if no object with the specified key exists in the map.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_remove_all, cl_hmap_insert
+*********/
+
+
+/****f* Component Library: Hash Map/cl_hmap_remove_all
+* NAME
+*	cl_hmap_remove_all
+*
+* DESCRIPTION
+*	The cl_hmap_remove_all function removes all objects from a hash map,
+*	leaving it empty.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_hmap_remove_all(
+	IN	cl_hmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a hash map to empty.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Hash Map, cl_hmap_remove
+*********/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _CL_HMAP_H_ */
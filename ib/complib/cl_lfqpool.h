@@ -0,0 +1,477 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of cl_lf_qpool_t.
+ *	This object represents a lock-free quick-pool of objects.
+ *
+ * Environment:
+ *	All
+ */
+
+#ifndef _CL_LFQPOOL_H_
+#define _CL_LFQPOOL_H_
+
+
+#include <complib/cl_qpool.h>
+#include <complib/cl_spinlock.h>
+#include <complib/cl_atomic.h>
+
+
+/****h* Component Library/Lock-Free Quick Pool
+* NAME
+*	Lock-Free Quick Pool
+*
+* DESCRIPTION
+*	The Lock-Free Quick Pool is a thread-safe quick pool whose get and put
+*	operations do not take a lock.  It is a drop-in replacement for the
+*	Quick Locking Pool.
+*
+*	Free objects are kept on a stack whose head is updated with
+*	cl_atomic_tagged_comp_xchg.  A lock is only taken when the stack is
+*	empty and objects must be taken from the underlying quick pool, which
+*	may grow it.
+*
+*	This object should be treated as opaque and should be
+*	manipulated only through the provided functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_lf_qpool_t
+*
+*	Initialization:
+*		cl_lf_qpool_construct, cl_lf_qpool_init, cl_lf_qpool_destroy
+*
+*	Manipulation
+*		cl_lf_qpool_get, cl_lf_qpool_put, cl_lf_qpool_put_list
+*********/
+
+
+/****s* Component Library: Lock-Free Quick Pool/cl_lf_qpool_t
+* NAME
+*	cl_lf_qpool_t
+*
+* DESCRIPTION
+*	Lock-Free Quick Pool structure.
+*
+*	This object should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_lf_qpool
+{
+	cl_tagged_ptr_t				free_head;
+	cl_spinlock_t				grow_lock;
+	cl_qpool_t					pool;
+
+} cl_lf_qpool_t;
+/*
+* FIELDS
+*	free_head
+*		Head of the stack of free objects, with its generation tag.
+*
+*	grow_lock
+*		Spinlock guarding the quick pool.
+*
+*	pool
+*		quick_pool of user objects.
+*
+* NOTES
+*	Objects are linked on the free stack through the p_next pointer of
+*	their cl_pool_item_t.  The tag of free_head changes with every push and
+*	pop, so a pop that raced with other operations fails and retries even
+*	if the head pointer has its original value.
+*
+*	Memory for objects is never released before the pool is destroyed, so
+*	reading the p_next pointer of an object that another thread has just
+*	removed is safe.
+*
+* SEE ALSO
+*	Lock-Free Quick Pool, cl_tagged_ptr_t
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Lock-Free Quick Pool/cl_lf_qpool_construct
+* NAME
+*	cl_lf_qpool_construct
+*
+* DESCRIPTION
+*	This function constructs a Lock-Free Quick Pool.
+*
+* SYNOPSIS
+*/
+static inline void
+cl_lf_qpool_construct(
+	IN cl_lf_qpool_t* const p_pool )
+{
+	p_pool->free_head.p_ptr = NULL;
+	p_pool->free_head.tag = 0;
+	cl_qpool_construct( &p_pool->pool );
+	cl_spinlock_construct( &p_pool->grow_lock );
+}
+
+/*
+* PARAMETERS
+*	p_pool
+*		[in] Pointer to a Lock-Free Quick Pool to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_lf_qpool_init, cl_lf_qpool_destroy
+*
+*	Calling cl_lf_qpool_construct is a prerequisite to calling any other
+*	method except cl_lf_qpool_init.
+*
+* SEE ALSO
+*	Lock-Free Quick Pool, cl_lf_qpool_init, cl_lf_qpool_destroy
+*********/
+
+
+/****f* Component Library: Lock-Free Quick Pool/cl_lf_qpool_destroy
+* NAME
+*	cl_lf_qpool_destroy
+*
+* DESCRIPTION
+*	The cl_lf_qpool_destroy function destroys a Lock-Free Quick Pool,
+*	releasing all resources.
+*
+* SYNOPSIS
+*/
+static inline void
+cl_lf_qpool_destroy(
+	IN cl_lf_qpool_t* const p_pool )
+{
+	cl_list_item_t	*p_list_item;
+
+	if( cl_is_qpool_inited( &p_pool->pool ) )
+	{
+		/* Return the free stack to the quick pool before destroying it. */
+		cl_spinlock_acquire( &p_pool->grow_lock );
+		p_list_item = (cl_list_item_t*)p_pool->free_head.p_ptr;
+		p_pool->free_head.p_ptr = NULL;
+		while( p_list_item )
+		{
+			cl_pool_item_t	*p_item = (cl_pool_item_t*)p_list_item;
+
+			p_list_item = p_list_item->p_next;
+			cl_qpool_put( &p_pool->pool, p_item );
+		}
+		cl_qpool_destroy( &p_pool->pool );
+		cl_spinlock_release( &p_pool->grow_lock );
+	}
+	else
+		cl_qpool_destroy( &p_pool->pool );
+
+	cl_spinlock_destroy( &p_pool->grow_lock );
+}
+/*
+* PARAMETERS
+*	p_pool
+*		[in] Pointer to a Lock-Free Quick Pool to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Performs any necessary cleanup of the specified Lock-Free Quick Pool.
+*	Further operations should not be attempted on the destroyed object.
+*	This function should only be called after a call to
+*	cl_lf_qpool_construct or cl_lf_qpool_init.
+*
+*	No other thread may access the pool while it is being destroyed.
+*
+* SEE ALSO
+*	Lock-Free Quick Pool, cl_lf_qpool_construct, cl_lf_qpool_init
+*********/
+
+
+/****f* Component Library: Lock-Free Quick Pool/cl_lf_qpool_init
+* NAME
+*	cl_lf_qpool_init
+*
+* DESCRIPTION
+*	The cl_lf_qpool_init function initializes a Lock-Free Quick Pool for use.
+*
+* SYNOPSIS
+*/
+static inline cl_status_t
+cl_lf_qpool_init(
+	IN cl_lf_qpool_t*			const p_pool,
+	IN	const size_t			min_size,
+	IN	const size_t			max_size,
+	IN	const size_t			grow_size,
+	IN	const size_t			object_size,
+	IN	cl_pfn_qpool_init_t		pfn_initializer OPTIONAL,
+	IN	cl_pfn_qpool_dtor_t		pfn_destructor OPTIONAL,
+	IN	const void* const		context )
+{
+	cl_status_t status;
+
+	cl_lf_qpool_construct( p_pool );
+
+	status = cl_spinlock_init( &p_pool->grow_lock );
+	if( status )
+		return( status );
+
+	status = cl_qpool_init( &p_pool->pool, min_size, max_size, grow_size,
+			object_size, pfn_initializer, pfn_destructor, context );
+
+	return( status );
+}
+/*
+* PARAMETERS
+*	p_pool
+*		[in] Pointer to an cl_lf_qpool_t object to initialize.
+*
+*	min_size
+*		[in] Minimum number of objects that the pool should support. All
+*		necessary allocations to allow storing the minimum number of items
+*		are performed at initialization time, and all necessary callbacks
+*		successfully invoked.
+*
+*	max_size
+*		[in] Maximum number of objects to which the pool is allowed to grow.
+*		A value of zero specifies no maximum.
+*
+*	grow_size
+*		[in] Number of objects to allocate when incrementally growing the pool.
+*		A value of zero disables automatic growth.
+*
+*	object_size
+*		[in] Size, in bytes, of each object.
+*
+*	pfn_initializer
+*		[in] Initialization callback to invoke for every new object when
+*		growing the pool. This parameter is optional and may be NULL. If NULL,
+*		the pool assumes the cl_pool_item_t structure describing objects is
+*		located at the head of each object. See the cl_pfn_qpool_init_t
+*		function type declaration for details about the callback function.
+*
+*	pfn_destructor
+*		[in] Destructor callback to invoke for every object before memory for
+*		that object is freed. This parameter is optional and may be NULL.
+*		See the cl_pfn_qpool_dtor_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback functions to provide context.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the quick pool was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to initialize the
+*	quick pool.
+*
+*	CL_INVALID_SETTING if a the maximum size is non-zero and less than the
+*	minimum size.
+*
+*	Other cl_status_t value returned by optional initialization callback function
+*	specified by the pfn_initializer parameter.
+*
+* NOTES
+*	Allows calling other Lock-Free Quick Pool methods.
+*
+*	The parameters are the same as those of cl_qlock_pool_init.
+*
+* SEE ALSO
+*	Lock-Free Quick Pool, cl_lf_qpool_construct, cl_lf_qpool_destroy
+*********/
+
+
+/****f* Component Library: Lock-Free Quick Pool/cl_lf_qpool_get
+* NAME
+*	cl_lf_qpool_get
+*
+* DESCRIPTION
+*	Retrieves an object from a Lock-Free Quick Pool.
+*
+* SYNOPSIS
+*/
+static inline cl_pool_item_t*
+cl_lf_qpool_get(
+	IN cl_lf_qpool_t* const p_pool )
+{
+	cl_tagged_ptr_t	head;
+	cl_pool_item_t	*p_item;
+
+	head = p_pool->free_head;
+	while( head.p_ptr )
+	{
+		p_item = (cl_pool_item_t*)head.p_ptr;
+		if( cl_atomic_tagged_comp_xchg( &p_pool->free_head, &head,
+			p_item->list_item.p_next ) )
+		{
+			return( p_item );
+		}
+	}
+
+	/* The free stack is empty.  Take an object from the quick pool. */
+	cl_spinlock_acquire( &p_pool->grow_lock );
+	p_item = cl_qpool_get( &p_pool->pool );
+	cl_spinlock_release( &p_pool->grow_lock );
+	return( p_item );
+}
+
+/*
+* PARAMETERS
+*	p_pool
+*		[in] Pointer to an cl_lf_qpool_t object.
+*
+* RETURN VALUES
+*	Returns a pointer to a cl_pool_item_t contained in the user object.
+*
+*	Returns NULL if the pool is empty and can not be grown automatically.
+*
+* NOTES
+*	The object must eventually be returned to the pool with a call to
+*	cl_lf_qpool_put or cl_lf_qpool_put_list.
+*
+*	The cl_lf_qpool_construct or cl_lf_qpool_init must be called before
+*	using this function.
+*
+* SEE ALSO
+*	Lock-Free Quick Pool, cl_lf_qpool_put
+*********/
+
+
+/****f* Component Library: Lock-Free Quick Pool/cl_lf_qpool_put
+* NAME
+*	cl_lf_qpool_put
+*
+* DESCRIPTION
+*	Returns an object to a Lock-Free Quick Pool.
+*
+* SYNOPSIS
+*/
+static inline void
+cl_lf_qpool_put(
+	IN cl_lf_qpool_t* const p_pool,
+	IN cl_pool_item_t* const p_item )
+{
+	cl_tagged_ptr_t	head;
+
+	head = p_pool->free_head;
+	do
+	{
+		p_item->list_item.p_next = (cl_list_item_t*)head.p_ptr;
+	} while( !cl_atomic_tagged_comp_xchg( &p_pool->free_head, &head, p_item ) );
+}
+/*
+* PARAMETERS
+*	p_pool
+*		[in] Pointer to an cl_lf_qpool_t object.
+*
+*	p_item
+*		[in] Pointer to the cl_pool_item_t in an object that was previously
+*		retrieved from the pool.
+*
+* RETURN VALUES
+*	This function does not return a value.
+*
+* NOTES
+*	The cl_lf_qpool_construct or cl_lf_qpool_init must be called before
+*	using this function.
+*
+* SEE ALSO
+*	Lock-Free Quick Pool, cl_lf_qpool_get, cl_lf_qpool_put_list
+*********/
+
+
+/****f* Component Library: Lock-Free Quick Pool/cl_lf_qpool_put_list
+* NAME
+*	cl_lf_qpool_put_list
+*
+* DESCRIPTION
+*	Returns a list of objects to a Lock-Free Quick Pool.
+*
+* SYNOPSIS
+*/
+static inline void
+cl_lf_qpool_put_list(
+	IN cl_lf_qpool_t* const p_pool,
+	IN cl_qlist_t* const p_list )
+{
+	cl_tagged_ptr_t	head;
+	cl_list_item_t	*p_first, *p_last;
+
+	if( cl_is_qlist_empty( p_list ) )
+		return;
+
+	/*
+		The list items already link the objects in order.  Detach them from
+		the list and push the whole chain with a single exchange.
+	*/
+	p_first = cl_qlist_head( p_list );
+	p_last = cl_qlist_tail( p_list );
+	cl_qlist_init( p_list );
+
+	head = p_pool->free_head;
+	do
+	{
+		p_last->p_next = (cl_list_item_t*)head.p_ptr;
+	} while( !cl_atomic_tagged_comp_xchg( &p_pool->free_head, &head, p_first ) );
+}
+/*
+* PARAMETERS
+*	p_pool
+*		[in] Pointer to an cl_lf_qpool_t object.
+*
+*	p_list
+*		[in] Pointer to a list of cl_pool_item_t objects that were previously
+*		retrieved from the pool.  The list is empty on return.
+*
+* RETURN VALUES
+*	This function does not return a value.
+*
+* NOTES
+*	Returning objects as a list costs a single atomic operation regardless
+*	of the number of objects.
+*
+*	The cl_lf_qpool_construct or cl_lf_qpool_init must be called before
+*	using this function.
+*
+* SEE ALSO
+*	Lock-Free Quick Pool, cl_lf_qpool_put, cl_qlist_t
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#endif	/* _CL_LFQPOOL_H_ */
@@ -0,0 +1,627 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of the lock contention profiler.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_LOCKPROF_H_
+#define _CL_LOCKPROF_H_
+
+
+#include <complib/cl_types.h>
+#include <complib/cl_timer.h>
+#include <complib/cl_atomic.h>
+
+
+/****h* Component Library/Lock Profiler
+* NAME
+*	Lock Profiler
+*
+* DESCRIPTION
+*	The Lock Profiler records, for every spin lock, mutex, passive lock and
+*	object lock, how often it is acquired, how often and how long callers
+*	wait for it, how long it is held, and which call sites acquire it.
+*
+*	Profiling is enabled by defining CL_PROFILE_LOCKS when building both
+*	complib and its users.  The acquire and release functions of each lock
+*	type then become macros that pass the caller's file and line, much like
+*	the memory tracking functions under CL_TRACK_MEM.  Without
+*	CL_PROFILE_LOCKS, none of this header is used and locks carry no
+*	overhead.
+*
+*	Locks are named with cl_spinlock_init_named, cl_mutex_init_named and
+*	cl_plock_init_named.  Locks initialized otherwise are registered,
+*	without a name, the first time they are acquired.
+*
+* SEE ALSO
+*	Structures:
+*		cl_lock_prof_t, cl_lock_type_t
+*
+*	Callbacks:
+*		cl_pfn_lock_prof_report_t
+*
+*	Registration:
+*		cl_lock_prof_register, cl_lock_prof_get, cl_lock_prof_deregister
+*
+*	Reporting:
+*		cl_lock_prof_report, cl_lock_prof_dump, cl_lock_prof_reset,
+*		cl_lock_prof_start_dump, cl_lock_prof_stop_dump
+*********/
+
+
+/****d* Component Library: Lock Profiler/CL_LOCK_PROF_CONTENDED_US
+* NAME
+*	CL_LOCK_PROF_CONTENDED_US
+*
+* DESCRIPTION
+*	Wait time, in microseconds, from which an acquisition counts as
+*	contended.
+*
+* SYNOPSIS
+*/
+#ifndef CL_LOCK_PROF_CONTENDED_US
+#define CL_LOCK_PROF_CONTENDED_US	20
+#endif
+/*
+* NOTES
+*	Complib locks have no try-acquire function, so contention is inferred
+*	from the time spent waiting.  cl_get_time_stamp has a resolution of one
+*	microsecond, and the profiler's own time stamps and bookkeeping add a
+*	few microseconds to every measured wait, so lower thresholds mostly
+*	count noise.  The default of 20 microseconds is well above that error
+*	and below the cost of a context switch, so that waits which parked the
+*	thread are always counted.  Shorter contended waits, such as a spin lock
+*	released after a few spins, are counted as uncontended.  Their wait
+*	time is still added to wait_total.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_t
+*********/
+
+
+/****d* Component Library: Lock Profiler/cl_lock_type_t
+* NAME
+*	cl_lock_type_t
+*
+* DESCRIPTION
+*	Identifies the type of a profiled lock.
+*
+* SYNOPSIS
+*/
+typedef enum _cl_lock_type
+{
+	CL_LOCK_SPINLOCK,
+	CL_LOCK_MUTEX,
+	CL_LOCK_PLOCK,
+	CL_LOCK_OBJ
+
+} cl_lock_type_t;
+/*
+* VALUES
+*	CL_LOCK_SPINLOCK
+*		A cl_spinlock_t.
+*
+*	CL_LOCK_MUTEX
+*		A cl_mutex_t.
+*
+*	CL_LOCK_PLOCK
+*		A cl_plock_t.
+*
+*	CL_LOCK_OBJ
+*		The lock of a cl_obj_t, acquired through cl_obj_lock.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_t
+*********/
+
+
+/****s* Component Library: Lock Profiler/cl_lock_prof_t
+* NAME
+*	cl_lock_prof_t
+*
+* DESCRIPTION
+*	Profile of a lock.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_lock_prof
+{
+	const void			*p_lock;
+	const char			*p_name;
+	cl_lock_type_t		type;
+	boolean_t			retired;
+
+	uint64_t			acquired;
+	uint64_t			contended;
+	uint64_t			wait_total;
+	uint64_t			wait_max;
+	uint64_t			hold_total;
+	uint64_t			hold_max;
+	atomic32_t			shared_acquired;
+	atomic32_t			shared_contended;
+
+	const char			*p_file_name;
+	int32_t				line_num;
+	const char			*p_wait_max_file;
+	int32_t				wait_max_line;
+	const char			*p_hold_max_file;
+	int32_t				hold_max_line;
+
+	uint64_t			hold_start;
+
+} cl_lock_prof_t;
+/*
+* FIELDS
+*	p_lock
+*		Address of the lock.
+*
+*	p_name
+*		Name given to the lock at initialization, or NULL.
+*
+*	type
+*		Type of the lock.
+*
+*	retired
+*		Set once the lock is destroyed.  The profile is kept, and reported,
+*		until cl_lock_prof_reset is called.
+*
+*	acquired
+*		Number of exclusive acquisitions.
+*
+*	contended
+*		Number of exclusive acquisitions that waited for at least
+*		CL_LOCK_PROF_CONTENDED_US microseconds.
+*
+*	wait_total
+*		Total time, in microseconds, spent waiting for exclusive access.
+*
+*	wait_max
+*		Longest wait for exclusive access, in microseconds.
+*
+*	hold_total
+*		Total time, in microseconds, the lock was held exclusively.
+*
+*	hold_max
+*		Longest exclusive hold, in microseconds.
+*
+*	shared_acquired
+*		Number of shared acquisitions of a passive lock.
+*
+*	shared_contended
+*		Number of shared acquisitions of a passive lock that waited.
+*
+*	p_file_name, line_num
+*		Call site of the last exclusive acquisition.
+*
+*	p_wait_max_file, wait_max_line
+*		Call site of the acquisition that waited for wait_max.
+*
+*	p_hold_max_file, hold_max_line
+*		Call site of the acquisition that held the lock for hold_max.
+*
+*	hold_start
+*		Time stamp of the current exclusive acquisition.
+*
+* NOTES
+*	Exclusive statistics are updated while the lock is held, so the lock
+*	itself serializes them and no atomic operation is needed.  Shared
+*	acquisitions run concurrently, so only their counts are kept, with
+*	atomic increments.
+*
+*	Reported values are read without synchronization with the lock's users
+*	and may be slightly inconsistent with each other.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_type_t, cl_lock_prof_report
+*********/
+
+
+/****d* Component Library: Lock Profiler/cl_pfn_lock_prof_report_t
+* NAME
+*	cl_pfn_lock_prof_report_t
+*
+* DESCRIPTION
+*	The cl_pfn_lock_prof_report_t function type defines the prototype for
+*	functions receiving lock profiles from cl_lock_prof_report.
+*
+* SYNOPSIS
+*/
+typedef void
+(CL_API *cl_pfn_lock_prof_report_t)(
+	IN	const cl_lock_prof_t* const	p_prof,
+	IN	void*						context );
+/*
+* PARAMETERS
+*	p_prof
+*		[in] Pointer to a copy of the profile of a lock.
+*
+*	context
+*		[in] Value passed to cl_lock_prof_report.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_report
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Lock Profiler/cl_lock_prof_register
+* NAME
+*	cl_lock_prof_register
+*
+* DESCRIPTION
+*	The cl_lock_prof_register function registers a lock with the profiler.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_lock_prof_t* CL_API
+cl_lock_prof_register(
+	IN	const void* const		p_lock,
+	IN	const cl_lock_type_t	type,
+	IN	const char* const		p_name OPTIONAL );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Address of the lock.
+*
+*	type
+*		[in] Type of the lock.
+*
+*	p_name
+*		[in] Name of the lock.  The string must remain valid until the
+*		profile is reset.
+*
+* RETURN VALUE
+*	Pointer to the profile of the lock.
+*
+*	NULL if the profile table is full, in which case the lock is not
+*	profiled.
+*
+* NOTES
+*	Profiles start from zero.  A profile already registered for p_lock
+*	is reused and renamed.
+*
+*	This function is called by the _init_named functions of each lock type,
+*	and does not normally need to be called directly.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_get, cl_lock_prof_deregister
+*********/
+
+
+/****f* Component Library: Lock Profiler/cl_lock_prof_get
+* NAME
+*	cl_lock_prof_get
+*
+* DESCRIPTION
+*	The cl_lock_prof_get function returns the profile of a lock,
+*	registering the lock if needed.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_lock_prof_t* CL_API
+cl_lock_prof_get(
+	IN	const void* const		p_lock,
+	IN	const cl_lock_type_t	type );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Address of the lock.
+*
+*	type
+*		[in] Type of the lock, used if the lock is registered.
+*
+* RETURN VALUE
+*	Pointer to the profile of the lock.
+*
+*	NULL if the profile table is full.
+*
+* NOTES
+*	Profiles are kept in a fixed size open addressed table keyed by lock
+*	address, which is searched without taking any lock.  This function is
+*	therefore safe to call at any IRQL, and adds a hash lookup to each
+*	profiled acquire and release.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_register
+*********/
+
+
+/****f* Component Library: Lock Profiler/cl_lock_prof_deregister
+* NAME
+*	cl_lock_prof_deregister
+*
+* DESCRIPTION
+*	The cl_lock_prof_deregister function marks the profile of a destroyed
+*	lock as retired.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_lock_prof_deregister(
+	IN	const void* const	p_lock );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Address of the destroyed lock.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The retired profile remains in reports until cl_lock_prof_reset is
+*	called, and a lock later initialized at the same address gets a new
+*	profile.
+*
+*	This function is called by the destroy function of each lock type.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_register, cl_lock_prof_reset
+*********/
+
+
+/****f* Component Library: Lock Profiler/cl_lock_prof_report
+* NAME
+*	cl_lock_prof_report
+*
+* DESCRIPTION
+*	The cl_lock_prof_report function invokes a callback for the profile of
+*	every registered lock.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_lock_prof_report(
+	IN	cl_pfn_lock_prof_report_t	pfn_report,
+	IN	void*						context );
+/*
+* PARAMETERS
+*	pfn_report
+*		[in] Callback invoked with a copy of each profile.
+*
+*	context
+*		[in] Value passed to the callback.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Profiles are reported in decreasing order of total wait time, so the
+*	most contended locks come first.  The callback may block and may call
+*	any profiler function except cl_lock_prof_reset.
+*
+* SEE ALSO
+*	Lock Profiler, cl_pfn_lock_prof_report_t, cl_lock_prof_dump
+*********/
+
+
+/****f* Component Library: Lock Profiler/cl_lock_prof_dump
+* NAME
+*	cl_lock_prof_dump
+*
+* DESCRIPTION
+*	The cl_lock_prof_dump function displays the profiles of the most
+*	contended locks to the applicable debugger.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_lock_prof_dump(
+	IN	const uint32_t	max_locks );
+/*
+* PARAMETERS
+*	max_locks
+*		[in] Maximum number of locks to display.  Zero displays all locks.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Each line shows the lock's name, or type and address if it is unnamed,
+*	followed by its counters, wait and hold times, and the call sites of
+*	the longest wait and hold.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_report, cl_lock_prof_start_dump
+*********/
+
+
+/****f* Component Library: Lock Profiler/cl_lock_prof_start_dump
+* NAME
+*	cl_lock_prof_start_dump
+*
+* DESCRIPTION
+*	The cl_lock_prof_start_dump function starts dumping lock profiles
+*	periodically.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_lock_prof_start_dump(
+	IN	const uint32_t	interval_ms,
+	IN	const uint32_t	max_locks,
+	IN	const boolean_t	reset );
+/*
+* PARAMETERS
+*	interval_ms
+*		[in] Time, in milliseconds, between two dumps.
+*
+*	max_locks
+*		[in] Maximum number of locks to display in each dump, as for
+*		cl_lock_prof_dump.
+*
+*	reset
+*		[in] If TRUE, statistics are reset after each dump, so that each
+*		dump covers a single interval.
+*
+* RETURN VALUE
+*	CL_SUCCESS if periodic dumps were started.
+*
+*	CL_INSUFFICIENT_RESOURCES if the timer could not be created.
+*
+* NOTES
+*	Calling this function while dumps are running changes the interval
+*	and options.  Dumps run from a timer callback and stop when
+*	cl_lock_prof_stop_dump is called.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_stop_dump, cl_lock_prof_dump
+*********/
+
+
+/****f* Component Library: Lock Profiler/cl_lock_prof_stop_dump
+* NAME
+*	cl_lock_prof_stop_dump
+*
+* DESCRIPTION
+*	The cl_lock_prof_stop_dump function stops periodic dumps of lock
+*	profiles.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_lock_prof_stop_dump( void );
+/*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_start_dump
+*********/
+
+
+/****f* Component Library: Lock Profiler/cl_lock_prof_reset
+* NAME
+*	cl_lock_prof_reset
+*
+* DESCRIPTION
+*	The cl_lock_prof_reset function clears the statistics of all locks
+*	and drops the profiles of retired locks.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_lock_prof_reset( void );
+/*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Names, types and call sites of live locks are kept.
+*
+* SEE ALSO
+*	Lock Profiler, cl_lock_prof_report, cl_lock_prof_deregister
+*********/
+
+
+/* Hooks used by the profiled lock functions. */
+CL_INLINE void CL_API
+__cl_lock_prof_acquired(
+	IN	cl_lock_prof_t* const	p_prof,
+	IN	const uint64_t			start_time,
+	IN	const char* const		p_file_name,
+	IN	const int32_t			line_num )
+{
+	uint64_t	now, wait;
+
+	if( !p_prof )
+		return;
+
+	now = cl_get_time_stamp();
+	wait = now - start_time;
+
+	p_prof->acquired++;
+	p_prof->wait_total += wait;
+	if( wait >= CL_LOCK_PROF_CONTENDED_US )
+	{
+		p_prof->contended++;
+		if( wait > p_prof->wait_max )
+		{
+			p_prof->wait_max = wait;
+			p_prof->p_wait_max_file = p_file_name;
+			p_prof->wait_max_line = line_num;
+		}
+	}
+	p_prof->p_file_name = p_file_name;
+	p_prof->line_num = line_num;
+	p_prof->hold_start = now;
+}
+
+
+CL_INLINE void CL_API
+__cl_lock_prof_acquired_shared(
+	IN	cl_lock_prof_t* const	p_prof,
+	IN	const uint64_t			start_time )
+{
+	if( !p_prof )
+		return;
+
+	cl_atomic_inc( &p_prof->shared_acquired );
+	if( cl_get_time_stamp() - start_time >= CL_LOCK_PROF_CONTENDED_US )
+		cl_atomic_inc( &p_prof->shared_contended );
+}
+
+
+CL_INLINE void CL_API
+__cl_lock_prof_releasing(
+	IN	cl_lock_prof_t* const	p_prof )
+{
+	uint64_t	hold;
+
+	if( !p_prof )
+		return;
+
+	hold = cl_get_time_stamp() - p_prof->hold_start;
+	p_prof->hold_total += hold;
+	if( hold > p_prof->hold_max )
+	{
+		p_prof->hold_max = hold;
+		p_prof->p_hold_max_file = p_prof->p_file_name;
+		p_prof->hold_max_line = p_prof->line_num;
+	}
+}
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#endif /* _CL_LOCKPROF_H_ */
@@ -0,0 +1,728 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of the magazine cache, a per-processor object cache in
+ *	front of a quick composite pool.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_MAGAZINE_H_
+#define _CL_MAGAZINE_H_
+
+
+#include <complib/cl_qcomppool.h>
+#include <complib/cl_spinlock.h>
+#include <complib/cl_atomic.h>
+#include <complib/cl_thread.h>
+
+
+/****h* Component Library/Magazine Cache
+* NAME
+*	Magazine Cache
+*
+* DESCRIPTION
+*	The Magazine Cache makes a quick composite pool, and therefore any quick
+*	pool, composite pool or pool, safe and scalable for use by multiple
+*	threads.
+*
+*	Each processor owns two magazines, arrays of up to mag_size free
+*	objects.  Getting an object pops it from the current processor's
+*	loaded magazine, and putting an object pushes it there.  Neither takes
+*	a lock.  Only when both magazines of a processor are empty, or both
+*	full, is a magazine exchanged with the depot, under the depot lock.
+*	Objects therefore move between processors and the underlying pool in
+*	batches of mag_size.
+*
+*	The underlying pool must only be accessed through the magazine cache
+*	once the cache is initialized.
+*
+*	The magazine cache functions operate on a cl_mag_cache_t structure which
+*	should be treated as opaque and should be manipulated only through the
+*	provided functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_mag_cache_t, cl_magazine_t, cl_mag_cpu_t
+*
+*	Initialization:
+*		cl_mag_cache_construct, cl_mag_cache_init, cl_mag_cache_destroy
+*
+*	Manipulation:
+*		cl_mag_cache_get, cl_mag_cache_put, cl_mag_cache_get_obj,
+*		cl_mag_cache_put_obj, cl_mag_cache_drain
+*
+*	Depot:
+*		cl_mag_cache_get_depot, cl_mag_cache_put_depot
+*
+* NOTES
+*	Magazine cache replaces the single lock of Quick Locking Pool.
+*
+*	The magazine design follows Bonwick and Adams, "Magazines and Vmem:
+*	Extending the Slab Allocator to Many CPUs and Arbitrary Resources",
+*	USENIX 2001.
+*********/
+
+
+/****d* Component Library: Magazine Cache/CL_MAG_CACHE_DEF_SIZE
+* NAME
+*	CL_MAG_CACHE_DEF_SIZE
+*
+* DESCRIPTION
+*	Default number of objects per magazine.
+*
+* SYNOPSIS
+*/
+#define CL_MAG_CACHE_DEF_SIZE	16
+/*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_init
+*********/
+
+
+/****s* Component Library: Magazine Cache/cl_magazine_t
+* NAME
+*	cl_magazine_t
+*
+* DESCRIPTION
+*	Array of free objects owned by a processor or held in the depot.
+*
+*	The cl_magazine_t structure is internal to the magazine cache and should
+*	not be manipulated by users.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_magazine
+{
+	cl_list_item_t			list_item;
+	uint32_t				count;
+	cl_pool_item_t			*p_rounds[1];
+
+} cl_magazine_t;
+/*
+* FIELDS
+*	list_item
+*		Used to store the magazine in the depot.
+*
+*	count
+*		Number of objects in the magazine.
+*
+*	p_rounds
+*		Objects in the magazine.  The array is allocated with mag_size
+*		entries.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_t
+*********/
+
+
+/****s* Component Library: Magazine Cache/cl_mag_cpu_t
+* NAME
+*	cl_mag_cpu_t
+*
+* DESCRIPTION
+*	Per-processor state of a magazine cache.
+*
+*	The cl_mag_cpu_t structure is internal to the magazine cache and should
+*	not be manipulated by users.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_mag_cpu
+{
+	atomic32_t				loaded;
+	int32_t					previous;
+	uint8_t					pad[CL_CACHE_LINE_SIZE - (2 * sizeof(int32_t))];
+
+} cl_mag_cpu_t;
+/*
+* FIELDS
+*	loaded
+*		One plus the index of the magazine objects are taken from and
+*		returned to, or zero while a thread has claimed the processor's
+*		magazines.
+*
+*	previous
+*		One plus the index of the processor's second magazine, or zero if
+*		it has none.  Only accessed by the thread that claimed loaded.
+*
+*	pad
+*		Padding so that each processor's state fills a cache line, and
+*		processors do not contend for the same line.
+*
+* NOTES
+*	A thread claims a processor's magazines by atomically exchanging
+*	loaded with zero, and releases them by storing the index back.  A
+*	thread finding loaded at zero, because another thread was scheduled
+*	on the same processor number, goes to the depot rather than wait.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_t
+*********/
+
+
+/****s* Component Library: Magazine Cache/cl_mag_cache_t
+* NAME
+*	cl_mag_cache_t
+*
+* DESCRIPTION
+*	Magazine cache structure.
+*
+*	The cl_mag_cache_t structure should be treated as opaque and should be
+*	manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_mag_cache
+{
+	cl_mag_cpu_t			*p_cpu;
+	uint32_t				cpu_mask;
+	uint32_t				mag_size;
+	cl_magazine_t			**pp_mags;
+	cl_qcpool_t				*p_pool;
+	cl_spinlock_t			depot_lock;
+	cl_qlist_t				full_list;
+	cl_qlist_t				empty_list;
+	cl_state_t				state;
+
+} cl_mag_cache_t;
+/*
+* FIELDS
+*	p_cpu
+*		Cache line aligned array of per-processor state, with cpu_mask + 1
+*		entries.
+*
+*	cpu_mask
+*		Mask applied to the current processor number to select an entry
+*		of p_cpu.  The number of entries is the number of processors
+*		rounded up to a power of two.
+*
+*	mag_size
+*		Number of objects each magazine can hold.
+*
+*	pp_mags
+*		Array of all magazines, indexed by the values stored in
+*		cl_mag_cpu_t.
+*
+*	p_pool
+*		Underlying pool from which objects are allocated.
+*
+*	depot_lock
+*		Lock serializing access to the depot lists and to the underlying
+*		pool.
+*
+*	full_list
+*		Depot list of full magazines.
+*
+*	empty_list
+*		Depot list of empty magazines.
+*
+*	state
+*		State of the magazine cache.
+*
+* NOTES
+*	Four magazines per processor are allocated at initialization: two
+*	loaded into each processor and two in the depot.  When the depot holds
+*	no empty magazine, objects overflowing a processor are returned to the
+*	underlying pool instead, so that the number of cached objects is
+*	bounded.
+*
+* SEE ALSO
+*	Magazine Cache
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_construct
+* NAME
+*	cl_mag_cache_construct
+*
+* DESCRIPTION
+*	The cl_mag_cache_construct function constructs a magazine cache.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mag_cache_construct(
+	IN	cl_mag_cache_t* const	p_cache );
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_mag_cache_destroy without first calling
+*	cl_mag_cache_init.
+*
+*	Calling cl_mag_cache_construct is a prerequisite to calling any other
+*	magazine cache function except cl_mag_cache_init.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_init, cl_mag_cache_destroy
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_init
+* NAME
+*	cl_mag_cache_init
+*
+* DESCRIPTION
+*	The cl_mag_cache_init function initializes a magazine cache in front
+*	of a pool.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_mag_cache_init(
+	IN	cl_mag_cache_t* const	p_cache,
+	IN	cl_qcpool_t* const		p_pool,
+	IN	const uint32_t			mag_size );
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure to initialize.
+*
+*	p_pool
+*		[in] Pointer to an initialized quick composite pool.  For a quick
+*		pool, composite pool or pool, pass the address of its qcpool
+*		member.
+*
+*	mag_size
+*		[in] Number of objects per magazine.  Zero selects
+*		CL_MAG_CACHE_DEF_SIZE.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the magazine cache was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to initialize the
+*	magazine cache.
+*
+* NOTES
+*	Magazines start empty.  The underlying pool must outlive the cache.
+*
+*	Larger magazines take the depot lock less often, at the cost of more
+*	objects held idle by each processor.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_construct, cl_mag_cache_destroy,
+*	CL_MAG_CACHE_DEF_SIZE
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_destroy
+* NAME
+*	cl_mag_cache_destroy
+*
+* DESCRIPTION
+*	The cl_mag_cache_destroy function destroys a magazine cache.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mag_cache_destroy(
+	IN	cl_mag_cache_t* const	p_cache );
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	All cached objects are returned to the underlying pool, which is not
+*	destroyed.  No thread may use the cache during or after this call.
+*
+*	This function should only be called after a call to
+*	cl_mag_cache_construct or cl_mag_cache_init.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_construct, cl_mag_cache_init
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_get_depot
+* NAME
+*	cl_mag_cache_get_depot
+*
+* DESCRIPTION
+*	The cl_mag_cache_get_depot function retrieves an object when the
+*	current processor's loaded magazine is empty or in use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_pool_item_t* CL_API
+cl_mag_cache_get_depot(
+	IN	cl_mag_cache_t* const	p_cache,
+	IN	cl_mag_cpu_t* const		p_cpu,
+	IN	const int32_t			mag_index );
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure.
+*
+*	p_cpu
+*		[in] Per-processor state selected by the caller.
+*
+*	mag_index
+*		[in] Value claimed from the loaded field of p_cpu.  Zero if the
+*		processor's magazines are in use by another thread.
+*
+* RETURN VALUES
+*	Returns a pointer to a cl_pool_item_t for an object.
+*
+*	Returns NULL if the underlying pool is empty and can not be grown.
+*
+* NOTES
+*	If the previous magazine holds objects, it is swapped with the loaded
+*	one.  Otherwise, the empty previous magazine is returned to the depot,
+*	the loaded one becomes the previous one, and a full magazine from the
+*	depot is loaded.  If the depot has no full magazine, or mag_index is
+*	zero, the object is taken from the underlying pool directly.
+*
+*	The function restores the loaded field of p_cpu before returning.
+*
+*	This function is called by cl_mag_cache_get and should not be called
+*	directly.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_get, cl_mag_cache_put_depot
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_put_depot
+* NAME
+*	cl_mag_cache_put_depot
+*
+* DESCRIPTION
+*	The cl_mag_cache_put_depot function returns an object when the
+*	current processor's loaded magazine is full or in use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mag_cache_put_depot(
+	IN	cl_mag_cache_t* const	p_cache,
+	IN	cl_mag_cpu_t* const		p_cpu,
+	IN	const int32_t			mag_index,
+	IN	cl_pool_item_t* const	p_pool_item );
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure.
+*
+*	p_cpu
+*		[in] Per-processor state selected by the caller.
+*
+*	mag_index
+*		[in] Value claimed from the loaded field of p_cpu.  Zero if the
+*		processor's magazines are in use by another thread.
+*
+*	p_pool_item
+*		[in] Pointer to the cl_pool_item_t of the object being returned.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	If the previous magazine has room, it is swapped with the loaded one.
+*	Otherwise, the full previous magazine is returned to the depot, the
+*	loaded one becomes the previous one, and an empty magazine from the
+*	depot is loaded.  If the depot has no empty magazine, or mag_index is
+*	zero, the object is returned to the underlying pool directly.
+*
+*	The function restores the loaded field of p_cpu before returning.
+*
+*	This function is called by cl_mag_cache_put and should not be called
+*	directly.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_put, cl_mag_cache_get_depot
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_get
+* NAME
+*	cl_mag_cache_get
+*
+* DESCRIPTION
+*	The cl_mag_cache_get function retrieves an object from a magazine cache.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_pool_item_t* CL_API
+cl_mag_cache_get(
+	IN	cl_mag_cache_t* const	p_cache )
+{
+	cl_mag_cpu_t	*p_cpu;
+	cl_magazine_t	*p_mag;
+	cl_pool_item_t	*p_pool_item;
+	int32_t			mag_index;
+
+	CL_ASSERT( p_cache );
+	CL_ASSERT( p_cache->state == CL_INITIALIZED );
+
+	p_cpu = &p_cache->p_cpu[cl_proc_current() & p_cache->cpu_mask];
+
+	/* Claim the processor's magazines. */
+	mag_index = cl_atomic_xchg( &p_cpu->loaded, 0 );
+	if( mag_index )
+	{
+		p_mag = p_cache->pp_mags[mag_index - 1];
+		if( p_mag->count )
+		{
+			p_pool_item = p_mag->p_rounds[--p_mag->count];
+			cl_atomic_xchg( &p_cpu->loaded, mag_index );
+			return( p_pool_item );
+		}
+	}
+
+	return( cl_mag_cache_get_depot( p_cache, p_cpu, mag_index ) );
+}
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure from which to retrieve
+*		an object.
+*
+* RETURN VALUES
+*	Returns a pointer to a cl_pool_item_t for an object.
+*
+*	Returns NULL if the underlying pool is empty and can not be grown.
+*
+* NOTES
+*	cl_mag_cache_get may be called by any number of threads concurrently.
+*	It takes no lock unless the current processor has no cached objects.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_put, cl_mag_cache_get_obj,
+*	cl_mag_cache_get_depot
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_put
+* NAME
+*	cl_mag_cache_put
+*
+* DESCRIPTION
+*	The cl_mag_cache_put function returns an object to a magazine cache.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_mag_cache_put(
+	IN	cl_mag_cache_t* const	p_cache,
+	IN	cl_pool_item_t* const	p_pool_item )
+{
+	cl_mag_cpu_t	*p_cpu;
+	cl_magazine_t	*p_mag;
+	int32_t			mag_index;
+
+	CL_ASSERT( p_cache );
+	CL_ASSERT( p_cache->state == CL_INITIALIZED );
+	CL_ASSERT( p_pool_item );
+	/* Make sure items being returned came from the underlying pool. */
+	CL_ASSERT( p_pool_item->p_pool == p_cache->p_pool );
+
+	p_cpu = &p_cache->p_cpu[cl_proc_current() & p_cache->cpu_mask];
+
+	/* Claim the processor's magazines. */
+	mag_index = cl_atomic_xchg( &p_cpu->loaded, 0 );
+	if( mag_index )
+	{
+		p_mag = p_cache->pp_mags[mag_index - 1];
+		if( p_mag->count < p_cache->mag_size )
+		{
+			p_mag->p_rounds[p_mag->count++] = p_pool_item;
+			cl_atomic_xchg( &p_cpu->loaded, mag_index );
+			return;
+		}
+	}
+
+	cl_mag_cache_put_depot( p_cache, p_cpu, mag_index, p_pool_item );
+}
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure to which to return
+*		an object.
+*
+*	p_pool_item
+*		[in] Pointer to the cl_pool_item_t of an object retrieved from the
+*		cache.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	cl_mag_cache_put may be called by any number of threads concurrently.
+*	It takes no lock unless the current processor's magazines are full.
+*
+*	An object may be returned on a different processor than the one it
+*	was retrieved on.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_get, cl_mag_cache_put_obj,
+*	cl_mag_cache_put_depot
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_get_obj
+* NAME
+*	cl_mag_cache_get_obj
+*
+* DESCRIPTION
+*	The cl_mag_cache_get_obj function retrieves an object from a magazine
+*	cache in front of a composite pool or pool.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_mag_cache_get_obj(
+	IN	cl_mag_cache_t* const	p_cache )
+{
+	cl_pool_obj_t	*p_pool_obj;
+
+	p_pool_obj = (cl_pool_obj_t*)cl_mag_cache_get( p_cache );
+	if( !p_pool_obj )
+		return( NULL );
+
+	CL_ASSERT( p_pool_obj->list_obj.p_object );
+	return( (void*)p_pool_obj->list_obj.p_object );
+}
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure initialized in front of
+*		a cl_cpool_t or cl_pool_t.
+*
+* RETURN VALUES
+*	Returns a pointer to an object, as cl_cpool_get and cl_pool_get do.
+*
+*	Returns NULL if the underlying pool is empty and can not be grown.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_get, cl_mag_cache_put_obj
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_put_obj
+* NAME
+*	cl_mag_cache_put_obj
+*
+* DESCRIPTION
+*	The cl_mag_cache_put_obj function returns an object to a magazine
+*	cache in front of a composite pool or pool.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_mag_cache_put_obj(
+	IN	cl_mag_cache_t* const	p_cache,
+	IN	void* const				p_object )
+{
+	cl_pool_obj_t	*p_pool_obj;
+
+	CL_ASSERT( p_object );
+
+	/* Calculate the offset to the list object representing this object. */
+	p_pool_obj = (cl_pool_obj_t*)
+		(((uint8_t*)p_object) - sizeof(cl_pool_obj_t));
+
+	/* good sanity check */
+	CL_ASSERT( p_pool_obj->list_obj.p_object == p_object );
+
+	cl_mag_cache_put( p_cache, (cl_pool_item_t*)p_pool_obj );
+}
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure initialized in front of
+*		a cl_cpool_t or cl_pool_t.
+*
+*	p_object
+*		[in] Pointer to an object retrieved with cl_mag_cache_get_obj.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_put, cl_mag_cache_get_obj
+*********/
+
+
+/****f* Component Library: Magazine Cache/cl_mag_cache_drain
+* NAME
+*	cl_mag_cache_drain
+*
+* DESCRIPTION
+*	The cl_mag_cache_drain function returns all objects held in the depot
+*	to the underlying pool.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mag_cache_drain(
+	IN	cl_mag_cache_t* const	p_cache );
+/*
+* PARAMETERS
+*	p_cache
+*		[in] Pointer to a cl_mag_cache_t structure to drain.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Objects held in processor magazines are not affected, since they can
+*	not be reached without claiming each processor's magazines.  Draining
+*	makes the cached objects available to cl_qcpool_count after a burst
+*	of activity.
+*
+* SEE ALSO
+*	Magazine Cache, cl_mag_cache_destroy
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+
+#endif /* _CL_MAGAZINE_H_ */
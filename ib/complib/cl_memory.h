@@ -68,6 +68,197 @@
 *	and can be enabled for the release version as well. To Enable memory
 *	tracking in a release build of the public layer, users should define
 *	the MEM_TRACK_ON keyword for compilation.
+*
+*	The Allocation Sampling functionality is a low overhead alternative to
+*	allocation tracking, meant to be left enabled in release builds.  Only
+*	a sample of allocations, on average one per configurable number of
+*	bytes allocated, is attributed to its call site.  Per call site totals
+*	are estimated from the samples.  Allocation sampling is enabled by
+*	defining the CL_SAMPLE_MEM keyword for compilation.
+*
+*	The Allocation Policy functionality allocates memory with control over
+*	page size and NUMA placement, for large buffers that are accessed from a
+*	known set of processors.  Pools accept a policy for their allocations.
+*
+*	cl_malloc, cl_zalloc and cl_free are served by a slab allocator for
+*	sizes up to CL_SLAB_MAX_SIZE.  Each size class keeps per-processor
+*	caches of free objects, and objects freed on a processor other than the
+*	one owning their slab are returned through a lock-free remote free
+*	queue.  Larger and pageable allocations go to the system heap.  The
+*	Memory Backend functions switch all allocations back to the system heap
+*	at run time, and defining CL_NO_SLAB_MEM when building the library
+*	removes the slab allocator.
+*********/
+
+
+/****d* Component Library: Memory Management/Allocation Policy Flags
+* NAME
+*	Allocation Policy Flags
+*
+* DESCRIPTION
+*	Flags that select the behavior of a cl_mem_policy_t.
+*
+* SYNOPSIS
+*/
+#define CL_MEM_POLICY_LARGE_PAGES		0x00000001
+#define CL_MEM_POLICY_REQUIRE_LARGE		0x00000002
+#define CL_MEM_POLICY_NODE				0x00000004
+#define CL_MEM_POLICY_FIRST_TOUCH		0x00000008
+/*
+* VALUES
+*	CL_MEM_POLICY_LARGE_PAGES
+*		Back allocations with large pages, 2MB on x86 and x64, when the
+*		system supports them and the caller is allowed to use them.
+*		Otherwise, allocations fall back to regular pages.
+*
+*	CL_MEM_POLICY_REQUIRE_LARGE
+*		Fail allocations that can not be backed by large pages instead of
+*		falling back to regular pages.  Implies CL_MEM_POLICY_LARGE_PAGES.
+*
+*	CL_MEM_POLICY_NODE
+*		Allocate physical memory from the NUMA node given by the numa_node
+*		field of the policy.
+*
+*	CL_MEM_POLICY_FIRST_TOUCH
+*		Touch every page of new allocations from the processor given by the
+*		touch_proc field of the policy, so that operating systems placing
+*		memory on first touch place it on that processor's node.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_policy_t
+*********/
+
+
+/****s* Component Library: Memory Management/cl_mem_policy_t
+* NAME
+*	cl_mem_policy_t
+*
+* DESCRIPTION
+*	Allocation policy used by cl_mem_policy_alloc.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_mem_policy
+{
+	uint32_t			flags;
+	uint32_t			numa_node;
+	uint32_t			touch_proc;
+
+} cl_mem_policy_t;
+/*
+* FIELDS
+*	flags
+*		Combination of Allocation Policy Flags.  Zero selects regular
+*		allocations from the system heap.
+*
+*	numa_node
+*		NUMA node to allocate from if CL_MEM_POLICY_NODE is set.
+*
+*	touch_proc
+*		Processor that touches new pages if CL_MEM_POLICY_FIRST_TOUCH is set.
+*
+* NOTES
+*	Use cl_mem_policy_init to initialize a policy before setting its fields.
+*
+* SEE ALSO
+*	Memory Management, Allocation Policy Flags, cl_mem_policy_init,
+*	cl_mem_policy_alloc, cl_mem_policy_free
+*********/
+
+
+/****d* Component Library: Memory Management/CL_SLAB_MAX_SIZE
+* NAME
+*	CL_SLAB_MAX_SIZE
+*
+* DESCRIPTION
+*	Largest allocation served by the slab allocator.
+*
+* SYNOPSIS
+*/
+#define CL_SLAB_MAX_SIZE		(32 * 1024)
+/*
+* NOTES
+*	Size classes are spaced by 16 bytes up to 128 bytes, then by a quarter
+*	of the next power of two, bounding internal fragmentation to 25%.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_backend_t
+*********/
+
+
+/****d* Component Library: Memory Management/cl_mem_backend_t
+* NAME
+*	cl_mem_backend_t
+*
+* DESCRIPTION
+*	The cl_mem_backend_t enumerated type identifies the allocator serving
+*	cl_malloc, cl_zalloc, cl_palloc and cl_pzalloc.
+*
+* SYNOPSIS
+*/
+typedef enum _cl_mem_backend
+{
+	CL_MEM_BACKEND_SYSTEM,
+	CL_MEM_BACKEND_SLAB
+
+} cl_mem_backend_t;
+/*
+* VALUES
+*	CL_MEM_BACKEND_SYSTEM
+*		All allocations go to the system heap.
+*
+*	CL_MEM_BACKEND_SLAB
+*		Non pageable allocations up to CL_SLAB_MAX_SIZE are served by the
+*		slab allocator.  This is the default unless the library was built
+*		with CL_NO_SLAB_MEM.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_set_backend, cl_mem_get_backend
+*********/
+
+
+/****s* Component Library: Memory Management/cl_slab_stats_t
+* NAME
+*	cl_slab_stats_t
+*
+* DESCRIPTION
+*	Statistics of the slab allocator.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_slab_stats
+{
+	uint64_t			alloc_count;
+	uint64_t			remote_free_count;
+	size_t				bytes_in_use;
+	size_t				bytes_reserved;
+	size_t				slab_count;
+
+} cl_slab_stats_t;
+/*
+* FIELDS
+*	alloc_count
+*		Number of allocations served by the slab allocator.
+*
+*	remote_free_count
+*		Number of objects freed on a processor other than the one owning
+*		their slab.
+*
+*	bytes_in_use
+*		Bytes of allocated objects, rounded up to their size class.
+*
+*	bytes_reserved
+*		Bytes of memory held by slabs, including free objects and per
+*		processor caches.
+*
+*	slab_count
+*		Number of slabs.
+*
+* NOTES
+*	The ratio of bytes_in_use to bytes_reserved measures fragmentation.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_slab_stats
 *********/
 
 
@@ -143,6 +334,399 @@ cl_mem_display( void );
 **********/
 
 
+/****d* Component Library: Memory Management/CL_MEM_SAMPLE_DEF_RATE
+* NAME
+*	CL_MEM_SAMPLE_DEF_RATE
+*
+* DESCRIPTION
+*	Default average number of bytes allocated between two samples.
+*
+* SYNOPSIS
+*/
+#define CL_MEM_SAMPLE_DEF_RATE		(512 * 1024)
+/*
+* SEE ALSO
+*	Memory Management, cl_mem_sample_set_rate
+*********/
+
+
+/****s* Component Library: Memory Management/cl_mem_site_stats_t
+* NAME
+*	cl_mem_site_stats_t
+*
+* DESCRIPTION
+*	Estimated allocation statistics of a call site.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_mem_site_stats
+{
+	const char			*p_file_name;
+	int32_t				line_num;
+	uint64_t			alloc_count;
+	uint64_t			alloc_bytes;
+	int64_t				live_count;
+	int64_t				live_bytes;
+
+} cl_mem_site_stats_t;
+/*
+* FIELDS
+*	p_file_name
+*		Name of the source file that made the allocations.
+*
+*	line_num
+*		Line number in the source file.
+*
+*	alloc_count
+*		Estimated number of allocations made since sampling started.
+*
+*	alloc_bytes
+*		Estimated number of bytes allocated since sampling started.
+*
+*	live_count
+*		Estimated number of allocations not yet freed.
+*
+*	live_bytes
+*		Estimated number of bytes not yet freed.
+*
+* NOTES
+*	Each sampled allocation of size bytes stands for the larger of size and
+*	the sample rate in bytes, and for that number of bytes divided by size
+*	allocations.  Estimates are therefore accurate for call sites that
+*	allocate many times the sample rate, and call sites allocating much
+*	less may not appear at all.
+*
+*	Live values are signed since, in a snapshot difference, they may
+*	decrease.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_snapshot_t
+*********/
+
+
+/****s* Component Library: Memory Management/cl_mem_snapshot_t
+* NAME
+*	cl_mem_snapshot_t
+*
+* DESCRIPTION
+*	Allocation statistics of all sampled call sites at a point in time.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_mem_snapshot
+{
+	uint32_t			sample_rate;
+	uint32_t			site_count;
+	cl_mem_site_stats_t	sites[1];
+
+} cl_mem_snapshot_t;
+/*
+* FIELDS
+*	sample_rate
+*		Sample rate in effect when the snapshot was taken.
+*
+*	site_count
+*		Number of entries in the sites array.
+*
+*	sites
+*		Statistics of each call site, sorted by decreasing live bytes.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_sample_snapshot, cl_mem_sample_diff,
+*	cl_mem_sample_dump
+*********/
+
+
+/****f* Component Library: Memory Management/cl_mem_sample_set_rate
+* NAME
+*	cl_mem_sample_set_rate
+*
+* DESCRIPTION
+*	The cl_mem_sample_set_rate function sets the average number of bytes
+*	allocated between two samples.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mem_sample_set_rate(
+	IN	const uint32_t	sample_rate );
+/*
+* PARAMETERS
+*	sample_rate
+*		[in] Average number of bytes allocated between two samples.  Zero
+*		stops sampling.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The rate starts at CL_MEM_SAMPLE_DEF_RATE.  Allocations not sampled
+*	only decrement a per-processor byte count, so the overhead of sampling
+*	is set by the rate.
+*
+*	Statistics collected at different rates are all scaled to estimates,
+*	so changing the rate does not reset them.
+*
+* SEE ALSO
+*	Memory Management, CL_MEM_SAMPLE_DEF_RATE
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_sample_snapshot
+* NAME
+*	cl_mem_sample_snapshot
+*
+* DESCRIPTION
+*	The cl_mem_sample_snapshot function captures the estimated allocation
+*	statistics of all sampled call sites.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_mem_sample_snapshot(
+	OUT	cl_mem_snapshot_t** const	pp_snapshot );
+/*
+* PARAMETERS
+*	pp_snapshot
+*		[out] Receives the snapshot.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the snapshot was captured.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the snapshot.
+*
+* NOTES
+*	The snapshot must be released with cl_mem_sample_free_snapshot.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_snapshot_t, cl_mem_sample_diff,
+*	cl_mem_sample_dump, cl_mem_sample_free_snapshot
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_sample_diff
+* NAME
+*	cl_mem_sample_diff
+*
+* DESCRIPTION
+*	The cl_mem_sample_diff function computes the change in allocation
+*	statistics between two snapshots.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_mem_sample_diff(
+	IN	const cl_mem_snapshot_t* const	p_old,
+	IN	const cl_mem_snapshot_t* const	p_new,
+	OUT	cl_mem_snapshot_t** const		pp_diff );
+/*
+* PARAMETERS
+*	p_old
+*		[in] Snapshot taken first.
+*
+*	p_new
+*		[in] Snapshot taken last.
+*
+*	pp_diff
+*		[out] Receives a snapshot holding, for each call site, the values in
+*		p_new minus the values in p_old.  Call sites with no change are
+*		omitted.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the difference was computed.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory for the result.
+*
+* NOTES
+*	The difference of live values shows the call sites whose memory grew
+*	between the snapshots, such as leaks.
+*
+*	The result must be released with cl_mem_sample_free_snapshot.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_sample_snapshot
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_sample_dump
+* NAME
+*	cl_mem_sample_dump
+*
+* DESCRIPTION
+*	The cl_mem_sample_dump function displays a snapshot to the applicable
+*	debugger.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mem_sample_dump(
+	IN	const cl_mem_snapshot_t* const	p_snapshot );
+/*
+* PARAMETERS
+*	p_snapshot
+*		[in] Snapshot or difference to display.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The output is one header line, "CL_MEM_SAMPLE 1 <rate> <site count>",
+*	followed by one line per call site with the following tab separated
+*	fields: file name, line number, allocation count, allocated bytes,
+*	live count and live bytes.  The format is stable so that dumps
+*	captured from the debugger or the system log can be processed offline.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_sample_snapshot, cl_mem_display
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_sample_free_snapshot
+* NAME
+*	cl_mem_sample_free_snapshot
+*
+* DESCRIPTION
+*	The cl_mem_sample_free_snapshot function releases a snapshot.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mem_sample_free_snapshot(
+	IN	cl_mem_snapshot_t* const	p_snapshot );
+/*
+* PARAMETERS
+*	p_snapshot
+*		[in] Snapshot returned by cl_mem_sample_snapshot or
+*		cl_mem_sample_diff.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_sample_snapshot, cl_mem_sample_diff
+**********/
+
+
+/****i* Component Library: Memory Management/__cl_malloc_smp
+* NAME
+*	__cl_malloc_smp
+*
+* DESCRIPTION
+*	The __cl_malloc_smp function allocates a block of memory and samples
+*	the allocation.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+__cl_malloc_smp(
+	IN	const char* const	p_file_name,
+	IN	const int32_t		line_num,
+	IN	const size_t		size,
+	IN	const boolean_t		pageable );
+/*
+* PARAMETERS
+*	p_file_name
+*		[in] Name of the source file initiating the allocation.
+*
+*	line_num
+*		[in] Line number in the specified file where the allocation is
+*		initiated.
+*
+*	size
+*		[in] Size of the requested allocation.
+*
+*	pageable
+*		[in] On operating systems that support pageable vs. non pageable
+*		memory in the kernel, set to TRUE to allocate memory from paged pool.
+*
+* RETURN VALUES
+*	Pointer to allocated memory if successful.
+*
+*	NULL otherwise.
+*
+* NOTES
+*	Allocated memory follows alignment rules specific to the different
+*	environments.  Every allocation carries a small header that identifies
+*	its call site if it was sampled, so that frees update the live
+*	statistics.
+*
+*	Clients should not call __cl_malloc_smp directly, and should
+*	instead use the cl_malloc macro.
+*
+* SEE ALSO
+*	Memory Management, __cl_zalloc_smp, __cl_free_smp
+**********/
+
+
+/****i* Component Library: Memory Management/__cl_zalloc_smp
+* NAME
+*	__cl_zalloc_smp
+*
+* DESCRIPTION
+*	The __cl_zalloc_smp function allocates a block of memory initialized
+*	to zero and samples the allocation.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+__cl_zalloc_smp(
+	IN	const char* const	p_file_name,
+	IN	const int32_t		line_num,
+	IN	const size_t		size,
+	IN	const boolean_t		pageable );
+/*
+* PARAMETERS
+*	Same as __cl_malloc_smp.
+*
+* RETURN VALUES
+*	Pointer to allocated memory if successful.
+*
+*	NULL otherwise.
+*
+* NOTES
+*	Clients should not call __cl_zalloc_smp directly, and should
+*	instead use the cl_zalloc macro.
+*
+* SEE ALSO
+*	Memory Management, __cl_malloc_smp, __cl_free_smp
+**********/
+
+
+/****i* Component Library: Memory Management/__cl_free_smp
+* NAME
+*	__cl_free_smp
+*
+* DESCRIPTION
+*	The __cl_free_smp function deallocates a block of memory allocated
+*	with sampling.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+__cl_free_smp(
+	IN	void* const	p_memory );
+/*
+* PARAMETERS
+*	p_memory
+*		[in] Pointer to a memory block.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The p_memory parameter is the pointer returned by a previous call to
+*	__cl_malloc_smp or __cl_zalloc_smp.
+*
+*	__cl_free_smp has no effect if p_memory is NULL.
+*
+*	Clients should not call __cl_free_smp directly, and should
+*	instead use the cl_free macro.
+*
+* SEE ALSO
+*	Memory Management, __cl_malloc_smp, __cl_zalloc_smp
+**********/
+
+
 /****i* Component Library: Memory Management/__cl_malloc_trk
 * NAME
 *	__cl_malloc_trk
@@ -409,6 +993,9 @@ cl_malloc(
 *	Allocated memory follows alignment rules specific to the different
 *	environments.
 *
+*	Allocations up to CL_SLAB_MAX_SIZE are served by the slab allocator
+*	unless the system heap was selected with cl_mem_set_backend.
+*
 * SEE ALSO
 *	Memory Management, cl_free, cl_zalloc, cl_palloc, cl_pzalloc,
 *	cl_memset, cl_memclr, cl_memcpy, cl_memcmp
@@ -547,6 +1134,233 @@ cl_free(
 **********/
 
 
+/****f* Component Library: Memory Management/cl_mem_policy_init
+* NAME
+*	cl_mem_policy_init
+*
+* DESCRIPTION
+*	The cl_mem_policy_init function initializes an allocation policy to
+*	regular allocations.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_mem_policy_init(
+	OUT	cl_mem_policy_t* const	p_policy )
+{
+	CL_ASSERT( p_policy );
+
+	p_policy->flags = 0;
+	p_policy->numa_node = 0;
+	p_policy->touch_proc = 0;
+}
+/*
+* PARAMETERS
+*	p_policy
+*		[out] Pointer to the allocation policy to initialize.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_policy_t
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_policy_alloc
+* NAME
+*	cl_mem_policy_alloc
+*
+* DESCRIPTION
+*	The cl_mem_policy_alloc function allocates a page aligned block of
+*	memory according to an allocation policy.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+cl_mem_policy_alloc(
+	IN	const cl_mem_policy_t* const	p_policy OPTIONAL,
+	IN	const size_t					size,
+	OUT	uint32_t* const					p_applied OPTIONAL );
+/*
+* PARAMETERS
+*	p_policy
+*		[in] Pointer to the allocation policy.  If NULL, the allocation is
+*		made from the system heap, as with cl_malloc.
+*
+*	size
+*		[in] Size of the requested allocation.
+*
+*	p_applied
+*		[out] Receives the Allocation Policy Flags that were honored.  In
+*		particular, CL_MEM_POLICY_LARGE_PAGES is cleared if the allocation
+*		fell back to regular pages.
+*
+* RETURN VALUES
+*	Pointer to allocated memory if successful.
+*
+*	NULL otherwise.
+*
+* NOTES
+*	Allocations made with CL_MEM_POLICY_LARGE_PAGES are rounded up to a
+*	whole number of large pages.  Callers should size allocations in
+*	multiples of the large page size to avoid waste.
+*
+*	In the kernel, memory allocated according to a policy is non-paged.
+*
+*	Memory must be released with cl_mem_policy_free, using the same policy.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_policy_t, cl_mem_policy_free, cl_malloc
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_policy_free
+* NAME
+*	cl_mem_policy_free
+*
+* DESCRIPTION
+*	The cl_mem_policy_free function deallocates a block of memory allocated
+*	by cl_mem_policy_alloc.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mem_policy_free(
+	IN	const cl_mem_policy_t* const	p_policy OPTIONAL,
+	IN	void* const						p_memory,
+	IN	const size_t					size );
+/*
+* PARAMETERS
+*	p_policy
+*		[in] Pointer to the allocation policy used to allocate the memory.
+*
+*	p_memory
+*		[in] Pointer returned by cl_mem_policy_alloc.
+*
+*	size
+*		[in] Size passed to cl_mem_policy_alloc.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	cl_mem_policy_free has no effect if p_memory is NULL.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_policy_alloc
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_set_backend
+* NAME
+*	cl_mem_set_backend
+*
+* DESCRIPTION
+*	The cl_mem_set_backend function selects the allocator serving later
+*	allocations.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_mem_set_backend(
+	IN	const cl_mem_backend_t	backend );
+/*
+* PARAMETERS
+*	backend
+*		[in] Allocator to use.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the allocator was selected.
+*
+*	CL_INVALID_OPERATION if CL_MEM_BACKEND_SLAB is requested and the
+*	library was built with CL_NO_SLAB_MEM.
+*
+* NOTES
+*	cl_free finds the allocator of a block from its address, so blocks
+*	allocated before the switch may be freed after it.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_backend_t, cl_mem_get_backend
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_get_backend
+* NAME
+*	cl_mem_get_backend
+*
+* DESCRIPTION
+*	The cl_mem_get_backend function returns the allocator serving
+*	allocations.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_mem_backend_t CL_API
+cl_mem_get_backend( void );
+/*
+* RETURN VALUE
+*	Allocator serving allocations.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_backend_t, cl_mem_set_backend
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_slab_stats
+* NAME
+*	cl_mem_slab_stats
+*
+* DESCRIPTION
+*	The cl_mem_slab_stats function returns statistics of the slab allocator.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mem_slab_stats(
+	OUT	cl_slab_stats_t* const	p_stats );
+/*
+* PARAMETERS
+*	p_stats
+*		[out] Receives the statistics.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Values are gathered from all processors without stopping allocations,
+*	and are therefore approximate.
+*
+* SEE ALSO
+*	Memory Management, cl_slab_stats_t, cl_mem_slab_trim
+**********/
+
+
+/****f* Component Library: Memory Management/cl_mem_slab_trim
+* NAME
+*	cl_mem_slab_trim
+*
+* DESCRIPTION
+*	The cl_mem_slab_trim function returns the memory of empty slabs to the
+*	system.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mem_slab_trim( void );
+/*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Per processor caches are flushed and remote free queues drained before
+*	empty slabs are released.  Slabs are otherwise kept for reuse once
+*	empty, to avoid repeatedly allocating and releasing memory.
+*
+* SEE ALSO
+*	Memory Management, cl_mem_slab_stats
+**********/
+
+
 /****f* Component Library: Memory Management/cl_memset
 * NAME
 *	cl_memset
@@ -905,13 +1719,18 @@ cl_copy_from_user(
 	#error Conflict: Cannot define both CL_NO_TRACK_MEM and CL_TRACK_MEM.
 #endif
 
+#if defined( CL_SAMPLE_MEM ) && defined( CL_TRACK_MEM )
+	#error Conflict: Cannot define both CL_SAMPLE_MEM and CL_TRACK_MEM.
+#endif
+
 /*
  * Turn on memory allocation tracking in debug builds if not explicitly
  * disabled or already turned on.
  */
 #if defined( _DEBUG_ ) && \
 	!defined( CL_NO_TRACK_MEM ) && \
-	!defined( CL_TRACK_MEM )
+	!defined( CL_TRACK_MEM ) && \
+	!defined( CL_SAMPLE_MEM )
 	#define CL_TRACK_MEM
 #endif
 
@@ -951,7 +1770,24 @@ cl_copy_from_user(
 #define cl_free( a )	\
 	__cl_free_trk( a )
 
-#else	/* !defined( CL_TRACK_MEM ) */
+#elif defined( CL_SAMPLE_MEM )
+
+#define cl_malloc( a )	\
+	__cl_malloc_smp( __FILE__, __LINE__, a, FALSE )
+
+#define cl_zalloc( a )	\
+	__cl_zalloc_smp( __FILE__, __LINE__, a, FALSE )
+
+#define cl_palloc( a )	\
+	__cl_malloc_smp( __FILE__, __LINE__, a, TRUE )
+
+#define cl_pzalloc( a )	\
+	__cl_zalloc_smp( __FILE__, __LINE__, a, TRUE )
+
+#define cl_free( a )	\
+	__cl_free_smp( a )
+
+#else	/* !defined( CL_TRACK_MEM ) && !defined( CL_SAMPLE_MEM ) */
 
 #define cl_malloc( a )	\
 	__cl_malloc_ntrk( a, FALSE )
@@ -45,6 +45,9 @@
 
 
 #include <complib/cl_mutex_osd.h>
+#ifdef CL_PROFILE_LOCKS
+#include <complib/cl_lockprof.h>
+#endif
 
 
 /****h* complib/Mutex
@@ -64,10 +67,14 @@
 *		cl_mutex_t
 *
 *	Initialization:
-*		cl_mutex_construct, cl_mutex_init, cl_mutex_destroy
+*		cl_mutex_construct, cl_mutex_init, cl_mutex_init_named,
+*		cl_mutex_destroy
 *
 *	Manipulation
 *		cl_mutex_acquire, cl_mutex_release
+*
+*	Statistics (CL_FUTEX_LOCKS only)
+*		cl_mutex_get_stats
 *********/
 
 
@@ -228,8 +235,143 @@ cl_mutex_release(
 *********/
 
 
+#ifdef CL_FUTEX_LOCKS
+
+/****f* Component Library: Mutex/cl_mutex_get_stats
+* NAME
+*	cl_mutex_get_stats
+*
+* DESCRIPTION
+*	The cl_mutex_get_stats function returns the contention statistics
+*	of a mutex.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_mutex_get_stats(
+	IN	const cl_mutex_t* const		p_mutex,
+	OUT	cl_lock_stats_t* const		p_stats );
+/*
+* PARAMETERS
+*	p_mutex
+*		[in] Pointer to a mutex structure.
+*
+*	p_stats
+*		[out] Receives the contention statistics of the mutex.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Available only when CL_FUTEX_LOCKS is defined.  Futex mutexes spin
+*	for a shorter time than spin locks before parking, and unlike the
+*	Windows mutex handle, they cannot be acquired recursively.
+*
+*	Futex mutexes are only available in user mode on Windows.  There is no
+*	futex backend for Linux, nor for cl_event_t, which always remains a
+*	kernel event handle.
+*
+* SEE ALSO
+*	Mutex, cl_mutex_acquire, cl_spinlock_get_stats
+*********/
+
+#endif	/* CL_FUTEX_LOCKS */
+
+
+/****f* Component Library: Mutex/cl_mutex_init_named
+* NAME
+*	cl_mutex_init_named
+*
+* DESCRIPTION
+*	The cl_mutex_init_named function initializes a mutex and names it for
+*	the lock profiler.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_status_t CL_API
+cl_mutex_init_named(
+	IN	cl_mutex_t* const	p_mutex,
+	IN	const char* const	p_name )
+{
+	cl_status_t	status;
+
+	status = cl_mutex_init( p_mutex );
+#ifdef CL_PROFILE_LOCKS
+	if( status == CL_SUCCESS )
+		cl_lock_prof_register( p_mutex, CL_LOCK_MUTEX, p_name );
+#else
+	UNUSED_PARAM( p_name );
+#endif
+	return( status );
+}
+/*
+* PARAMETERS
+*	p_mutex
+*		[in] Pointer to a mutex structure to initialize.
+*
+*	p_name
+*		[in] Name of the mutex in profiler reports.  The string must remain
+*		valid while the mutex is profiled.
+*
+* RETURN VALUES
+*	Same as cl_mutex_init.
+*
+* NOTES
+*	The name is ignored unless CL_PROFILE_LOCKS is defined.
+*
+* SEE ALSO
+*	Mutex, cl_mutex_init, Lock Profiler
+*********/
+
+
 #ifdef __cplusplus
 }	/* extern "C" */
 #endif
 
+
+#ifdef CL_PROFILE_LOCKS
+
+CL_INLINE void CL_API
+__cl_mutex_acquire_prof(
+	IN	cl_mutex_t* const	p_mutex,
+	IN	const char* const	p_file_name,
+	IN	const int32_t		line_num )
+{
+	cl_lock_prof_t	*p_prof;
+	uint64_t		start_time;
+
+	p_prof = cl_lock_prof_get( p_mutex, CL_LOCK_MUTEX );
+	start_time = cl_get_time_stamp();
+	(cl_mutex_acquire)( p_mutex );
+	__cl_lock_prof_acquired( p_prof, start_time, p_file_name, line_num );
+}
+
+
+CL_INLINE void CL_API
+__cl_mutex_release_prof(
+	IN	cl_mutex_t* const	p_mutex )
+{
+	__cl_lock_prof_releasing( cl_lock_prof_get( p_mutex, CL_LOCK_MUTEX ) );
+	(cl_mutex_release)( p_mutex );
+}
+
+
+CL_INLINE void CL_API
+__cl_mutex_destroy_prof(
+	IN	cl_mutex_t* const	p_mutex )
+{
+	cl_lock_prof_deregister( p_mutex );
+	(cl_mutex_destroy)( p_mutex );
+}
+
+
+#define cl_mutex_acquire( p_mutex ) \
+	__cl_mutex_acquire_prof( p_mutex, __FILE__, __LINE__ )
+#define cl_mutex_release( p_mutex ) \
+	__cl_mutex_release_prof( p_mutex )
+#define cl_mutex_destroy( p_mutex ) \
+	__cl_mutex_destroy_prof( p_mutex )
+
+#endif	/* CL_PROFILE_LOCKS */
+
 #endif /* _CL_MUTEX_H_ */
@@ -995,4 +995,38 @@ cl_obj_remove_rel(
 #endif
 
 
+#ifdef CL_PROFILE_LOCKS
+
+/* Profile object locks separately from other spin locks, by call site. */
+CL_INLINE void CL_API
+__cl_obj_lock_prof(
+	IN				cl_obj_t * const			p_obj,
+	IN				const char * const			p_file_name,
+	IN				const int32_t				line_num )
+{
+	CL_ASSERT( p_obj->state == CL_INITIALIZED ||
+		p_obj->state == CL_DESTROYING );
+	__cl_spinlock_acquire_prof(
+		&p_obj->lock, CL_LOCK_OBJ, p_file_name, line_num );
+}
+
+
+CL_INLINE void CL_API
+__cl_obj_unlock_prof(
+	IN				cl_obj_t * const			p_obj )
+{
+	CL_ASSERT( p_obj->state == CL_INITIALIZED ||
+		p_obj->state == CL_DESTROYING );
+	__cl_spinlock_release_prof( &p_obj->lock, CL_LOCK_OBJ );
+}
+
+
+#define cl_obj_lock( p_obj ) \
+	__cl_obj_lock_prof( p_obj, __FILE__, __LINE__ )
+#define cl_obj_unlock( p_obj ) \
+	__cl_obj_unlock_prof( p_obj )
+
+#endif	/* CL_PROFILE_LOCKS */
+
+
 #endif /* __CL_OBJ_H__ */
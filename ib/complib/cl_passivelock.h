@@ -49,6 +49,9 @@
 
 #include <complib/cl_event.h>
 #include <complib/cl_atomic.h>
+#ifdef CL_PROFILE_LOCKS
+#include <complib/cl_lockprof.h>
+#endif
 
 
 /****h* Component Library/Passive Lock
@@ -62,6 +65,10 @@
 *	Passive lock works exclusively between threads and cannot be used in
 *	situations where the caller cannot be put into a waiting state.
 *
+*	Every shared acquisition waits on and signals an event shared by all
+*	readers.  Read mostly data should use the Reader Writer Lock, which
+*	provides the same functions without serializing readers.
+*
 *	The passive lock functions operate a cl_plock_t structure which should
 *	be treated as opaque and should be manipulated only through the provided
 *	functions.
@@ -71,7 +78,8 @@
 *		cl_plock_t
 *
 *	Initialization:
-*		cl_plock_construct, cl_plock_init, cl_plock_destroy
+*		cl_plock_construct, cl_plock_init, cl_plock_init_named,
+*		cl_plock_destroy
 *
 *	Manipulation
 *		cl_plock_acquire, cl_plock_excl_acquire, cl_plock_release
@@ -430,4 +438,115 @@ cl_plock_release(
 *********/
 
 
+/****f* Component Library: Passive Lock/cl_plock_init_named
+* NAME
+*	cl_plock_init_named
+*
+* DESCRIPTION
+*	The cl_plock_init_named function initializes a passive lock and names
+*	it for the lock profiler.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_status_t CL_API
+cl_plock_init_named(
+	IN	cl_plock_t* const	p_lock,
+	IN	const char* const	p_name )
+{
+	cl_status_t	status;
+
+	status = cl_plock_init( p_lock );
+#ifdef CL_PROFILE_LOCKS
+	if( status == CL_SUCCESS )
+		cl_lock_prof_register( p_lock, CL_LOCK_PLOCK, p_name );
+#else
+	UNUSED_PARAM( p_name );
+#endif
+	return( status );
+}
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_plock_t structure to initialize.
+*
+*	p_name
+*		[in] Name of the lock in profiler reports.  The string must remain
+*		valid while the lock is profiled.
+*
+* RETURN VALUES
+*	Same as cl_plock_init.
+*
+* NOTES
+*	The name is ignored unless CL_PROFILE_LOCKS is defined.  Exclusive
+*	acquisitions are fully profiled, shared acquisitions are only counted.
+*
+* SEE ALSO
+*	Passive Lock, cl_plock_init, Lock Profiler
+*********/
+
+
+#ifdef CL_PROFILE_LOCKS
+
+CL_INLINE void CL_API
+__cl_plock_acquire_prof(
+	IN	cl_plock_t* const	p_lock )
+{
+	cl_lock_prof_t	*p_prof;
+	uint64_t		start_time;
+
+	p_prof = cl_lock_prof_get( p_lock, CL_LOCK_PLOCK );
+	start_time = cl_get_time_stamp();
+	(cl_plock_acquire)( p_lock );
+	__cl_lock_prof_acquired_shared( p_prof, start_time );
+}
+
+
+CL_INLINE void CL_API
+__cl_plock_excl_acquire_prof(
+	IN	cl_plock_t* const	p_lock,
+	IN	const char* const	p_file_name,
+	IN	const int32_t		line_num )
+{
+	cl_lock_prof_t	*p_prof;
+	uint64_t		start_time;
+
+	p_prof = cl_lock_prof_get( p_lock, CL_LOCK_PLOCK );
+	start_time = cl_get_time_stamp();
+	(cl_plock_excl_acquire)( p_lock );
+	__cl_lock_prof_acquired( p_prof, start_time, p_file_name, line_num );
+}
+
+
+CL_INLINE void CL_API
+__cl_plock_release_prof(
+	IN	cl_plock_t* const	p_lock )
+{
+	/* Hold times are only tracked for exclusive access. */
+	if( !p_lock->reader_count )
+		__cl_lock_prof_releasing( cl_lock_prof_get( p_lock, CL_LOCK_PLOCK ) );
+	(cl_plock_release)( p_lock );
+}
+
+
+CL_INLINE void CL_API
+__cl_plock_destroy_prof(
+	IN	cl_plock_t* const	p_lock )
+{
+	cl_lock_prof_deregister( p_lock );
+	(cl_plock_destroy)( p_lock );
+}
+
+
+#define cl_plock_acquire( p_lock ) \
+	__cl_plock_acquire_prof( p_lock )
+#define cl_plock_excl_acquire( p_lock ) \
+	__cl_plock_excl_acquire_prof( p_lock, __FILE__, __LINE__ )
+#define cl_plock_release( p_lock ) \
+	__cl_plock_release_prof( p_lock )
+#define cl_plock_destroy( p_lock ) \
+	__cl_plock_destroy_prof( p_lock )
+
+#endif	/* CL_PROFILE_LOCKS */
+
+
 #endif /* _CL_PASSIVE_LOCK_H_ */
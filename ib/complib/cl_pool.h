@@ -77,7 +77,7 @@
 *		cl_pfn_pool_init_t, cl_pfn_pool_dtor_t
 *
 *	Initialization/Destruction:
-*		cl_pool_construct, cl_pool_init, cl_pool_destroy
+*		cl_pool_construct, cl_pool_init, cl_pool_init_ex, cl_pool_destroy
 *
 *	Manipulation:
 *		cl_pool_get, cl_pool_put, cl_pool_grow
@@ -373,6 +373,47 @@ cl_pool_init(
 *********/
 
 
+/****f* Component Library: Pool/cl_pool_init_ex
+* NAME
+*	cl_pool_init_ex
+*
+* DESCRIPTION
+*	The cl_pool_init_ex function initializes a pool for use, with
+*	an allocation policy.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_pool_init_ex(
+	IN	cl_pool_t* const		p_pool,
+	IN	const size_t			min_count,
+	IN	const size_t			max_count,
+	IN	const size_t			grow_size,
+	IN	const size_t			object_size,
+	IN	const cl_mem_policy_t* const	p_policy OPTIONAL,
+	IN	cl_pfn_pool_init_t		pfn_initializer OPTIONAL,
+	IN	cl_pfn_pool_dtor_t		pfn_destructor OPTIONAL,
+	IN	const void* const		context );
+/*
+* PARAMETERS
+*	p_policy
+*		[in] Allocation policy used whenever the pool grows.  The policy is
+*		copied into the pool.  If NULL, the pool allocates from the system
+*		heap, as with cl_pool_init.
+*
+*	Other parameters are the same as those of cl_pool_init.
+*
+* RETURN VALUES
+*	Same as cl_pool_init.
+*
+*	CL_INSUFFICIENT_MEMORY is also returned if the policy requires large
+*	pages and none are available.
+*
+* SEE ALSO
+*	Pool, cl_pool_init, cl_mem_policy_t
+*********/
+
+
 /****f* Component Library: Pool/cl_pool_destroy
 * NAME
 *	cl_pool_destroy
@@ -58,6 +58,12 @@
 *	with a specified index.  A pointer vector grows transparently as the
 *	user adds elements to the array.
 *
+*	A pointer vector initialized with cl_ptr_vector_init_paged stores its
+*	pointers in fixed size pages reached through a page directory.  Pages
+*	are only allocated when a non-NULL pointer is first stored in them, and
+*	growing the vector only reallocates the directory.  This suits large,
+*	mostly empty tables indexed by an identifier, such as a LID.
+*
 *	The cl_pointer vector_t structure should be treated as opaque and should be
 *	manipulated only through the provided functions.
 *
@@ -72,7 +78,8 @@
 *		cl_ptr_vector_set_obj, cl_ptr_vector_obj
 *
 *	Initialization:
-*		cl_ptr_vector_construct, cl_ptr_vector_init, cl_ptr_vector_destroy
+*		cl_ptr_vector_construct, cl_ptr_vector_init,
+*		cl_ptr_vector_init_paged, cl_ptr_vector_destroy
 *
 *	Manipulation:
 *		cl_ptr_vector_get_capacity, cl_ptr_vector_set_capacity,
@@ -81,7 +88,7 @@
 *
 *	Search:
 *		cl_ptr_vector_find_from_start, cl_ptr_vector_find_from_end
-*		cl_ptr_vector_apply_func
+*		cl_ptr_vector_apply_func, cl_ptr_vector_next_used
 *********/
 
 
@@ -187,6 +194,9 @@ typedef struct _cl_ptr_vector
 	size_t				capacity;
 	const void			**p_ptr_array;
 	cl_state_t			state;
+	uint32_t			page_shift;
+	size_t				page_count;
+	const void			***p_page_array;
 
 } cl_ptr_vector_t;
 /*
@@ -209,6 +219,21 @@ typedef struct _cl_ptr_vector
 *	state
 *		State of the pointer vector.
 *
+*	page_shift
+*		Base 2 logarithm of the number of pointers per page of a paged
+*		pointer vector, or zero if the pointer vector is not paged.
+*
+*	page_count
+*		Number of entries in the page directory.
+*
+*	p_page_array
+*		Page directory of a paged pointer vector.  Entries for pages that
+*		hold no pointer yet are NULL.
+*
+* NOTES
+*	p_ptr_array is only used by pointer vectors that are not paged, and
+*	p_page_array only by paged pointer vectors.
+*
 * SEE ALSO
 *	Pointer Vector
 *********/
@@ -290,6 +315,87 @@ cl_ptr_vector_init(
 *********/
 
 
+/****d* Component Library: Pointer Vector/CL_PTR_VECTOR_PAGE_SIZE
+* NAME
+*	CL_PTR_VECTOR_PAGE_SIZE
+*
+* DESCRIPTION
+*	Default number of pointers per page of a paged pointer vector.
+*
+* SYNOPSIS
+*/
+#define CL_PTR_VECTOR_PAGE_SIZE		512
+/*
+* NOTES
+*	A page of 512 pointers occupies a 4KB memory page on 64-bit platforms.
+*
+* SEE ALSO
+*	Pointer Vector, cl_ptr_vector_init_paged
+*********/
+
+
+/****f* Component Library: Pointer Vector/cl_ptr_vector_init_paged
+* NAME
+*	cl_ptr_vector_init_paged
+*
+* DESCRIPTION
+*	The cl_ptr_vector_init_paged function initializes a paged pointer vector
+*	for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_ptr_vector_init_paged(
+	IN	cl_ptr_vector_t* const	p_vector,
+	IN	const size_t			min_cap,
+	IN	const size_t			page_size );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_ptr_vector_t structure to inititalize.
+*
+*	min_cap
+*		[in] Initial number of elements the vector will support.
+*		The vector is always initialized with a size of zero.  Only the page
+*		directory is allocated for this capacity.
+*
+*	page_size
+*		[in] Number of pointers per page.  Must be a power of two.
+*		Use CL_PTR_VECTOR_PAGE_SIZE unless the distribution of indices
+*		calls for smaller or larger pages.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the pointer vector was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if the initialization failed.
+*
+*	CL_INVALID_PARAMETER if page_size is not a power of two greater
+*	than one.
+*
+* NOTES
+*	A paged pointer vector supports the same operations as other pointer
+*	vectors, with the following differences:
+*
+*	The vector always grows as needed.  Growing it reallocates the page
+*	directory, but never moves or copies pages.
+*
+*	Storing a NULL pointer in a page that was never allocated does not
+*	allocate it.  Reading any element of such a page returns NULL.
+*
+*	Pages are released when the size of the vector is reduced below them,
+*	and when the vector is destroyed.
+*
+*	cl_ptr_vector_remove moves all elements above the removed one, across
+*	pages, and may allocate pages as a result.  Paged pointer vectors are
+*	meant for tables with fixed indices, where elements are cleared by
+*	setting them to NULL rather than removed.
+*
+* SEE ALSO
+*	Pointer Vector, cl_ptr_vector_init, cl_ptr_vector_destroy,
+*	cl_ptr_vector_next_used, CL_PTR_VECTOR_PAGE_SIZE
+*********/
+
+
 /****f* Component Library: Pointer Vector/cl_ptr_vector_destroy
 * NAME
 *	cl_ptr_vector_destroy
@@ -409,6 +515,18 @@ cl_ptr_vector_get(
 	CL_ASSERT( p_vector->state == CL_INITIALIZED );
 	CL_ASSERT( p_vector->size > index );
 
+	if( p_vector->page_shift )
+	{
+		const void	**p_page;
+
+		p_page = p_vector->p_page_array[index >> p_vector->page_shift];
+		if( !p_page )
+			return( NULL );
+
+		return( (void*)
+			p_page[index & (((size_t)1 << p_vector->page_shift) - 1)] );
+	}
+
 	return( (void*)p_vector->p_ptr_array[index] );
 }
 /*
@@ -425,6 +543,8 @@ cl_ptr_vector_get(
 *
 * NOTES
 *	cl_ptr_vector_get provides constant access times regardless of the index.
+*	For a paged pointer vector, this costs one extra memory access to read
+*	the page directory.
 *
 *	cl_ptr_vector_get does not perform boundary checking. Callers are
 *	responsible for providing an index that is within the range of the pointer
@@ -693,6 +813,9 @@ cl_ptr_vector_set_size(
 *
 *	This function can only fail if size is larger than the current capacity.
 *
+*	For a paged pointer vector, growing only reallocates the page directory,
+*	and shrinking releases the pages wholly above the new size.
+*
 * SEE ALSO
 *	Pointer Vector, cl_ptr_vector_get_size, cl_ptr_vector_set_min_size,
 *	cl_ptr_vector_set_capacity
@@ -870,6 +993,46 @@ cl_ptr_vector_find_from_end(
 *********/
 
 
+/****f* Component Library: Pointer Vector/cl_ptr_vector_next_used
+* NAME
+*	cl_ptr_vector_next_used
+*
+* DESCRIPTION
+*	The cl_ptr_vector_next_used function returns the index of the next
+*	non-NULL element of a pointer vector.
+*
+* SYNOPSIS
+*/
+CL_EXPORT size_t CL_API
+cl_ptr_vector_next_used(
+	IN	const cl_ptr_vector_t* const	p_vector,
+	IN	const size_t					start );
+/*
+* PARAMETERS
+*	p_vector
+*		[in] Pointer to a cl_ptr_vector_t structure to search.
+*
+*	start
+*		[in] Index of the first element to check.
+*
+* RETURN VALUES
+*	Lowest index at or above start whose element is not NULL.
+*
+*	Size of the pointer vector if there is no such element.
+*
+* NOTES
+*	For a paged pointer vector, pages that were never allocated are skipped
+*	without reading them.
+*
+*	To visit all stored pointers, start at index zero and continue at the
+*	returned index plus one until the size of the vector is returned.
+*
+* SEE ALSO
+*	Pointer Vector, cl_ptr_vector_init_paged, cl_ptr_vector_get,
+*	cl_ptr_vector_apply_func
+*********/
+
+
 #ifdef __cplusplus
 }	/* extern "C" */
 #endif
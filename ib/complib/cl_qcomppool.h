@@ -49,6 +49,7 @@
 
 #include <complib/cl_types.h>
 #include <complib/cl_qlist.h>
+#include <complib/cl_memory.h>
 
 
 /****h* Component Library/Quick Composite Pool
@@ -78,23 +79,32 @@
 *	If using a cl_pool_item_t is not desired, the Composite Pool provides
 *	similar functionality but operates on opaque objects.
 *
+*	By default, the components of each object are allocated back-to-back.
+*	A pool initialized with cl_qcpool_init_ex and CL_QCPOOL_LAYOUT_SOA
+*	instead places each component in its own page aligned array, so that
+*	scanning one component across all objects touches only that component.
+*
 *	The Quick Composit Pool functions operate on a cl_qcpool_t structure
 *	which should be treated as opaque and should be manipulated only through
 *	the provided functions.
 *
 * SEE ALSO
 *	Structures:
-*		cl_qcpool_t, cl_pool_item_t
+*		cl_qcpool_t, cl_pool_item_t, cl_qcpool_layout_t
 *
 *	Callbacks:
 *		cl_pfn_qcpool_init_t, cl_pfn_qcpool_dtor_t
 *
 *	Initialization/Destruction:
-*		cl_qcpool_construct, cl_qcpool_init, cl_qcpool_destroy
+*		cl_qcpool_construct, cl_qcpool_init, cl_qcpool_init_ex,
+*		cl_qcpool_destroy
 *
 *	Manipulation:
 *		cl_qcpool_get, cl_qcpool_put, cl_qcpool_put_list, cl_qcpool_grow
 *
+*	Component Access:
+*		cl_qcpool_get_components, cl_qcpool_get_comp_array
+*
 *	Attributes:
 *		cl_is_qcpool_inited, cl_qcpool_count
 *********/
@@ -283,6 +293,50 @@ typedef void
 *********/
 
 
+/****d* Component Library: Quick Composite Pool/cl_qcpool_layout_t
+* NAME
+*	cl_qcpool_layout_t
+*
+* DESCRIPTION
+*	The cl_qcpool_layout_t enumerated type selects how a quick composite
+*	pool places the components of its objects in memory.
+*
+* SYNOPSIS
+*/
+typedef enum _cl_qcpool_layout
+{
+	CL_QCPOOL_LAYOUT_AOS,
+	CL_QCPOOL_LAYOUT_SOA
+
+} cl_qcpool_layout_t;
+/*
+* VALUES
+*	CL_QCPOOL_LAYOUT_AOS
+*		The components of an object are allocated back-to-back, and objects
+*		follow each other in memory.  This is the layout used by
+*		cl_qcpool_init.
+*
+*	CL_QCPOOL_LAYOUT_SOA
+*		Each grow operation allocates one array per component.  Each array
+*		starts on a page boundary and holds that component for all objects
+*		of the allocation, at a stride of the component size rounded up to a
+*		multiple of the pointer size.
+*
+* NOTES
+*	The layout does not change how objects are retrieved or returned, nor
+*	the component array passed to the cl_pfn_qcpool_init_t callback.
+*
+*	With CL_QCPOOL_LAYOUT_SOA, a pool that never grows past its initial
+*	allocation, for instance because grow_size is zero, stores each
+*	component in a single contiguous array.  Such an array can be
+*	registered as a single memory region, and its size is rounded up to a
+*	whole number of pages so that it may be backed by large pages.
+*
+* SEE ALSO
+*	Quick Composite Pool, cl_qcpool_init_ex, cl_qcpool_get_comp_array
+*********/
+
+
 /****s* Component Library: Quick Composite Pool/cl_qcpool_t
 * NAME
 *	cl_qcpool_t
@@ -309,6 +363,8 @@ typedef struct _cl_qcpool
 	cl_qlist_t				free_list;
 	cl_qlist_t				alloc_list;
 	cl_state_t				state;
+	cl_qcpool_layout_t		layout;
+	cl_mem_policy_t			policy;
 
 } cl_qcpool_t;
 /*
@@ -349,8 +405,19 @@ typedef struct _cl_qcpool
 *	state
 *		State of the pool.
 *
+*	layout
+*		Placement of the components of the objects in memory.
+*
+*	policy
+*		Allocation policy used to grow the pool.
+*
+* NOTES
+*	With CL_QCPOOL_LAYOUT_SOA, each entry in alloc_list describes one
+*	allocation and the component arrays it holds.  Objects are numbered in
+*	the order in which they were allocated, starting at zero.
+*
 * SEE ALSO
-*	Quick Composite Pool
+*	Quick Composite Pool, cl_qcpool_layout_t
 *********/
 
 
@@ -516,13 +583,73 @@ cl_qcpool_init(
 *	cl_qcpool_init initializes, and if necessary, grows the pool to
 *	the capacity desired.
 *
+*	cl_qcpool_init is equivalent to calling cl_qcpool_init_ex with
+*	CL_QCPOOL_LAYOUT_AOS.
+*
 * SEE ALSO
 *	Quick Composite Pool, cl_qcpool_construct, cl_qcpool_destroy,
-*	cl_qcpool_get, cl_qcpool_put, cl_qcpool_grow,
+*	cl_qcpool_get, cl_qcpool_put, cl_qcpool_grow, cl_qcpool_init_ex,
 *	cl_qcpool_count, cl_pfn_qcpool_init_t, cl_pfn_qcpool_dtor_t
 *********/
 
 
+/****f* Component Library: Quick Composite Pool/cl_qcpool_init_ex
+* NAME
+*	cl_qcpool_init_ex
+*
+* DESCRIPTION
+*	The cl_qcpool_init_ex function initializes a quick composite pool for
+*	use, with the specified component layout.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_qcpool_init_ex(
+	IN	cl_qcpool_t* const		p_pool,
+	IN	const size_t			min_size,
+	IN	const size_t			max_size,
+	IN	const size_t			grow_size,
+	IN	const size_t* const		component_sizes,
+	IN	const uint32_t			num_components,
+	IN	const cl_qcpool_layout_t	layout,
+	IN	const cl_mem_policy_t* const	p_policy OPTIONAL,
+	IN	cl_pfn_qcpool_init_t	pfn_initializer OPTIONAL,
+	IN	cl_pfn_qcpool_dtor_t	pfn_destructor OPTIONAL,
+	IN	const void* const		context );
+/*
+* PARAMETERS
+*	layout
+*		[in] Placement of the components of the objects in memory.
+*		See cl_qcpool_layout_t.
+*
+*	p_policy
+*		[in] Allocation policy used whenever the pool grows.  The policy is
+*		copied into the pool.  If NULL, the pool allocates from the system
+*		heap, as with cl_qcpool_init.
+*
+*	Other parameters are the same as those of cl_qcpool_init.
+*
+* RETURN VALUES
+*	Same as cl_qcpool_init.
+*
+*	CL_INSUFFICIENT_MEMORY is also returned if the policy requires large
+*	pages and none are available.
+*
+* NOTES
+*	cl_qcpool_get, cl_qcpool_put and the cl_pool_item_t returned by the
+*	initializer callback behave the same with both layouts.
+*
+*	With CL_QCPOOL_LAYOUT_SOA, each component array is allocated separately
+*	according to the policy.  With CL_QCPOOL_LAYOUT_AOS, each grow makes a
+*	single allocation according to the policy.  Setting grow_size so that
+*	grows fill whole large pages avoids waste.
+*
+* SEE ALSO
+*	Quick Composite Pool, cl_qcpool_init, cl_qcpool_layout_t,
+*	cl_qcpool_get_components, cl_qcpool_get_comp_array, cl_mem_policy_t
+*********/
+
+
 /****f* Component Library: Quick Composite Pool/cl_qcpool_destroy
 * NAME
 *	cl_qcpool_destroy
@@ -777,6 +904,111 @@ cl_qcpool_grow(
 *********/
 
 
+/****f* Component Library: Quick Composite Pool/cl_qcpool_get_components
+* NAME
+*	cl_qcpool_get_components
+*
+* DESCRIPTION
+*	The cl_qcpool_get_components function returns pointers to all
+*	components of the object with the specified index.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_qcpool_get_components(
+	IN	const cl_qcpool_t* const	p_pool,
+	IN	const size_t				index,
+	OUT	void** const				p_comp_array );
+/*
+* PARAMETERS
+*	p_pool
+*		[in] Pointer to a cl_qcpool_t structure initialized with
+*		CL_QCPOOL_LAYOUT_SOA.
+*
+*	index
+*		[in] Index of the object, between zero and the number of objects
+*		managed by the pool minus one.
+*
+*	p_comp_array
+*		[out] Array of num_components entries that receives pointers to the
+*		components of the object, in the order given at initialization.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the components were returned.
+*
+*	CL_INVALID_PARAMETER if the index is out of range.
+*
+*	CL_INVALID_SETTING if the pool does not use CL_QCPOOL_LAYOUT_SOA.
+*
+* NOTES
+*	The object may be either in the pool or retrieved by a user.  The pool
+*	does not track which objects are retrieved.
+*
+*	The cost is proportional to the number of allocations the pool has
+*	made, which is one for pools that do not grow.
+*
+* SEE ALSO
+*	Quick Composite Pool, cl_qcpool_init_ex, cl_qcpool_get_comp_array
+*********/
+
+
+/****f* Component Library: Quick Composite Pool/cl_qcpool_get_comp_array
+* NAME
+*	cl_qcpool_get_comp_array
+*
+* DESCRIPTION
+*	The cl_qcpool_get_comp_array function returns the array holding a
+*	component for all objects of one allocation of a quick composite pool.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void* CL_API
+cl_qcpool_get_comp_array(
+	IN	const cl_qcpool_t* const	p_pool,
+	IN	const size_t				alloc_index,
+	IN	const uint32_t				comp_index,
+	OUT	size_t* const				p_count,
+	OUT	size_t* const				p_stride );
+/*
+* PARAMETERS
+*	p_pool
+*		[in] Pointer to a cl_qcpool_t structure initialized with
+*		CL_QCPOOL_LAYOUT_SOA.
+*
+*	alloc_index
+*		[in] Index of the allocation, zero being the allocation made when
+*		the pool was initialized.
+*
+*	comp_index
+*		[in] Index of the component, in the order given at initialization.
+*
+*	p_count
+*		[out] Number of objects whose component is in the array.
+*
+*	p_stride
+*		[out] Distance, in bytes, between consecutive components in the
+*		array.
+*
+* RETURN VALUES
+*	Pointer to the page aligned component array.
+*
+*	NULL if the pool does not use CL_QCPOOL_LAYOUT_SOA, or if either index
+*	is out of range.
+*
+* NOTES
+*	Allocations are numbered in the order in which they were made, and the
+*	objects of an allocation follow those of the previous allocations.
+*	Callers walk all objects by incrementing alloc_index until NULL is
+*	returned.
+*
+*	The array spans p_count times p_stride bytes rounded up to a whole
+*	number of pages, and may be registered with a device as one region.
+*
+* SEE ALSO
+*	Quick Composite Pool, cl_qcpool_init_ex, cl_qcpool_get_components
+*********/
+
+
 #ifdef __cplusplus
 }	/* extern "C" */
 #endif	/* __cplusplus */
@@ -0,0 +1,872 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of quick hash map, an open addressing hash table where the
+ *	caller provides storage for the items.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_QHMAP_H_
+#define _CL_QHMAP_H_
+
+
+#include <complib/cl_memory.h>
+#include <complib/cl_qpool.h>
+
+
+/****h* Component Library/Quick Hash Map
+* NAME
+*	Quick Hash Map
+*
+* DESCRIPTION
+*	Quick hash map stores user provided cl_hmap_item_t structures in an
+*	open addressing hash table indexed by a unique 64-bit key (duplicates
+*	are not allowed).  Quick hash map provides constant time point lookups
+*	but, unlike quick map, does not keep its items in key order.
+*
+*	Collisions are resolved with linear probing using Robin Hood ordering:
+*	an item being placed displaces any item that is closer to its home slot,
+*	which keeps probe sequences short and lets an unsuccessful search stop
+*	as soon as it passes an item closer to home than the searched key.
+*	Each slot holds a copy of the key, so probing never touches the items.
+*
+*	The table grows incrementally.  When the table must grow, a table of
+*	twice the size is allocated and subsequent insertions and removals each
+*	move a bounded number of slots from the old table into the new one.
+*	Lookups search both tables until the old table is drained, so no single
+*	operation ever pays for rehashing the whole map.
+*
+*	Quick hash map allocates its slot table, and can therefore fail
+*	insertions due to insufficient memory.  It never allocates memory for
+*	the items themselves.
+*
+*	Quick hash map is not thread safe, and users must provide serialization
+*	when adding and removing items from the map.
+*
+*	The quick hash map functions operate on a cl_qhmap_t structure which
+*	should be treated as opaque and should be manipulated only through the
+*	provided functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_qhmap_t, cl_hmap_item_t, cl_hmap_slot_t, cl_hmap_table_t
+*
+*	Callbacks:
+*		cl_pfn_qhmap_apply_t
+*
+*	Item Manipulation:
+*		cl_qhmap_key
+*
+*	Initialization:
+*		cl_qhmap_construct, cl_qhmap_init, cl_qhmap_destroy
+*
+*	Manipulation:
+*		cl_qhmap_insert, cl_qhmap_get, cl_qhmap_remove_item, cl_qhmap_remove,
+*		cl_qhmap_remove_all
+*
+*	Search:
+*		cl_qhmap_apply_func
+*
+*	Attributes:
+*		cl_qhmap_count, cl_is_qhmap_empty, cl_is_qhmap_inited
+*********/
+
+
+/****d* Component Library: Quick Hash Map/CL_QHMAP_REHASH_SLOTS
+* NAME
+*	CL_QHMAP_REHASH_SLOTS
+*
+* DESCRIPTION
+*	Number of old table slots migrated by each insertion or removal while
+*	a quick hash map is growing.
+*
+* SYNOPSIS
+*/
+#define CL_QHMAP_REHASH_SLOTS	32
+/*
+* NOTES
+*	The table grows once it is seven eighths full.  Migrating 32 slots per
+*	operation drains the old table long before the new one, which is twice
+*	as large, needs to grow again.
+*
+* SEE ALSO
+*	Quick Hash Map
+*********/
+
+
+/****s* Component Library: Quick Hash Map/cl_hmap_item_t
+* NAME
+*	cl_hmap_item_t
+*
+* DESCRIPTION
+*	The cl_hmap_item_t structure is used by hash maps to store objects.
+*
+*	The cl_hmap_item_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_hmap_item
+{
+	/* Must be first to allow casting. */
+	cl_pool_item_t			pool_item;
+	uint64_t				key;
+#ifdef _DEBUG_
+	struct _cl_qhmap		*p_map;
+#endif
+
+} cl_hmap_item_t;
+/*
+* FIELDS
+*	pool_item
+*		Used to store the item in a pool and to allow the item to be
+*		allocated from a quick pool.  Hash maps that allocate their items,
+*		such as cl_hmap_t, rely on this field being first.
+*
+*	key
+*		Value that uniquely represents an item in a map.  This value is set
+*		by calling cl_qhmap_insert and can be retrieved by calling
+*		cl_qhmap_key.
+*
+* NOTES
+*	None of the fields of this structure should be manipulated by users, as
+*	they are crititcal to the proper operation of the map in which they
+*	are stored.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_insert, cl_qhmap_key
+*********/
+
+
+/****s* Component Library: Quick Hash Map/cl_hmap_slot_t
+* NAME
+*	cl_hmap_slot_t
+*
+* DESCRIPTION
+*	Slot of a quick hash map table.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_hmap_slot
+{
+	uint64_t				key;
+	cl_hmap_item_t			*p_item;
+
+} cl_hmap_slot_t;
+/*
+* FIELDS
+*	key
+*		Copy of the key of the item stored in the slot.
+*
+*	p_item
+*		Item stored in the slot, or NULL if the slot is empty.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_hmap_table_t
+*********/
+
+
+/****s* Component Library: Quick Hash Map/cl_hmap_table_t
+* NAME
+*	cl_hmap_table_t
+*
+* DESCRIPTION
+*	Slot table of a quick hash map.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_hmap_table
+{
+	cl_hmap_slot_t			*p_slots;
+	uint32_t				mask;
+	uint32_t				shift;
+	uint32_t				count;
+
+} cl_hmap_table_t;
+/*
+* FIELDS
+*	p_slots
+*		Array of slots, or NULL if the table is not allocated.
+*
+*	mask
+*		Number of slots in the table minus one.  The number of slots is
+*		always a power of two.
+*
+*	shift
+*		64 minus the base 2 logarithm of the number of slots.  Shifting
+*		the 64-bit hash product right by shift keeps its top bits as the
+*		home slot index.  Set to 63 for a one slot table, where the mask
+*		discards the extra bit.
+*
+*	count
+*		Number of occupied slots.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_hmap_slot_t
+*********/
+
+
+/****s* Component Library: Quick Hash Map/cl_qhmap_t
+* NAME
+*	cl_qhmap_t
+*
+* DESCRIPTION
+*	Quick hash map structure.
+*
+*	The cl_qhmap_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_qhmap
+{
+	cl_hmap_table_t			table;
+	cl_hmap_table_t			old_table;
+	uint32_t				rehash_pos;
+	size_t					count;
+	cl_state_t				state;
+
+} cl_qhmap_t;
+/*
+* FIELDS
+*	table
+*		Table into which new items are inserted.
+*
+*	old_table
+*		Table being drained into table while the map grows.  Its p_slots
+*		member is NULL when no growth is in progress.
+*
+*	rehash_pos
+*		Index of the next old_table slot to migrate.
+*
+*	count
+*		Number of items in the map.
+*
+*	state
+*		State of the map, used to verify that operations are permitted.
+*
+* SEE ALSO
+*	Quick Hash Map
+*********/
+
+
+/****d* Component Library: Quick Hash Map/cl_pfn_qhmap_apply_t
+* NAME
+*	cl_pfn_qhmap_apply_t
+*
+* DESCRIPTION
+*	The cl_pfn_qhmap_apply_t function type defines the prototype for
+*	functions used to iterate items in a quick hash map.
+*
+* SYNOPSIS
+*/
+typedef void
+(CL_API *cl_pfn_qhmap_apply_t)(
+	IN	cl_hmap_item_t* const	p_map_item,
+	IN	void*					context );
+/*
+* PARAMETERS
+*	p_map_item
+*		[in] Pointer to a cl_hmap_item_t structure.
+*
+*	context
+*		[in] Value passed to the callback function.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	This function type is provided as function prototype reference for the
+*	function provided by users as a parameter to the cl_qhmap_apply_func
+*	function.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_apply_func
+*********/
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_count
+* NAME
+*	cl_qhmap_count
+*
+* DESCRIPTION
+*	The cl_qhmap_count function returns the number of items stored
+*	in a quick hash map.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_qhmap_count(
+	IN	const cl_qhmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	return( p_map->count );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure whose item count to return.
+*
+* RETURN VALUE
+*	Returns the number of items stored in the map.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_is_qhmap_empty
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_is_qhmap_empty
+* NAME
+*	cl_is_qhmap_empty
+*
+* DESCRIPTION
+*	The cl_is_qhmap_empty function returns whether a quick hash map
+*	is empty.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_qhmap_empty(
+	IN	const cl_qhmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+
+	return( p_map->count == 0 );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure to test for emptiness.
+*
+* RETURN VALUES
+*	TRUE if the quick hash map is empty.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_count, cl_qhmap_remove_all
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_key
+* NAME
+*	cl_qhmap_key
+*
+* DESCRIPTION
+*	The cl_qhmap_key function retrieves the key value of a map item.
+*
+* SYNOPSIS
+*/
+CL_INLINE uint64_t CL_API
+cl_qhmap_key(
+	IN	const cl_hmap_item_t* const	p_item )
+{
+	CL_ASSERT( p_item );
+	return( p_item->key );
+}
+/*
+* PARAMETERS
+*	p_item
+*		[in] Pointer to a map item whose key value to return.
+*
+* RETURN VALUE
+*	Returns the 64-bit key value for the specified map item.
+*
+* NOTES
+*	The key value is set in a call to cl_qhmap_insert.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_insert
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_construct
+* NAME
+*	cl_qhmap_construct
+*
+* DESCRIPTION
+*	The cl_qhmap_construct function constructs a quick hash map.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_qhmap_construct(
+	IN	cl_qhmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+
+	cl_memclr( p_map, sizeof(cl_qhmap_t) );
+	p_map->state = CL_UNINITIALIZED;
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_qhmap_init, cl_qhmap_destroy, and cl_is_qhmap_inited.
+*
+*	Calling cl_qhmap_construct is a prerequisite to calling any other
+*	quick hash map function except cl_qhmap_init.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_init, cl_qhmap_destroy, cl_is_qhmap_inited
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_is_qhmap_inited
+* NAME
+*	cl_is_qhmap_inited
+*
+* DESCRIPTION
+*	The cl_is_qhmap_inited function returns whether a quick hash map was
+*	successfully initialized.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_qhmap_inited(
+	IN	const cl_qhmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( cl_is_state_valid( p_map->state ) );
+
+	return( p_map->state == CL_INITIALIZED );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure whose initialization state
+*		to check.
+*
+* RETURN VALUES
+*	TRUE if the map was initialized successfully.
+*
+*	FALSE otherwise.
+*
+* SEE ALSO
+*	Quick Hash Map
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_init
+* NAME
+*	cl_qhmap_init
+*
+* DESCRIPTION
+*	The cl_qhmap_init function initializes a quick hash map for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_qhmap_init(
+	IN	cl_qhmap_t* const	p_map,
+	IN	const size_t		min_items );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure to initialize.
+*
+*	min_items
+*		[in] Minimum number of items that can be stored without growing the
+*		slot table.  The table is sized at initialization time.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the map was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to allocate the
+*	slot table.
+*
+* NOTES
+*	Allows calling quick hash map manipulation functions.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_destroy, cl_qhmap_insert, cl_qhmap_remove
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_destroy
+* NAME
+*	cl_qhmap_destroy
+*
+* DESCRIPTION
+*	The cl_qhmap_destroy function destroys a quick hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_qhmap_destroy(
+	IN	cl_qhmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Frees the slot tables.  cl_qhmap_destroy does not affect any of the
+*	items stored in the map.  This function should only be called after a
+*	call to cl_qhmap_construct or cl_qhmap_init.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_construct, cl_qhmap_init
+*********/
+
+
+/****i* Component Library: Quick Hash Map/__cl_qhmap_hash
+* NAME
+*	__cl_qhmap_hash
+*
+* DESCRIPTION
+*	Returns the home slot index of a key in a slot table.
+*
+* SYNOPSIS
+*/
+CL_INLINE uint32_t CL_API
+__cl_qhmap_hash(
+	IN	const cl_hmap_table_t* const	p_table,
+	IN	const uint64_t					key )
+{
+	/*
+	 * Fibonacci hashing.  GUIDs and LIDs share their low order bits, so
+	 * multiply by 2^64 divided by the golden ratio.  Only the top bits of
+	 * the product depend on every bit of the key, so the index is taken
+	 * from the top log2(size) bits rather than by masking lower ones.
+	 */
+	return( (uint32_t)((key * CL_CONST64(0x9E3779B97F4A7C15)) >>
+		p_table->shift) );
+}
+/*
+* NOTES
+*	The result is below the number of slots of the table, except for one
+*	slot tables where it may be 1.  Callers mask it with the table's mask,
+*	which they also need to wrap probe sequences.
+*********/
+
+
+/****i* Component Library: Quick Hash Map/__cl_qhmap_find
+* NAME
+*	__cl_qhmap_find
+*
+* DESCRIPTION
+*	Searches a single slot table for a key.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_hmap_item_t* CL_API
+__cl_qhmap_find(
+	IN	const cl_hmap_table_t* const	p_table,
+	IN	const uint64_t					key )
+{
+	const cl_hmap_slot_t	*p_slot;
+	uint32_t				home, dist;
+
+	if( !p_table->p_slots )
+		return( NULL );
+
+	home = __cl_qhmap_hash( p_table, key );
+	for( dist = 0; ; dist++ )
+	{
+		p_slot = &p_table->p_slots[(home + dist) & p_table->mask];
+		if( !p_slot->p_item )
+			return( NULL );
+
+		if( p_slot->key == key )
+			return( p_slot->p_item );
+
+		/*
+		 * Robin Hood ordering guarantees that the key would have displaced
+		 * any item closer to its home slot than the key is to its own.
+		 */
+		if( ((home + dist - __cl_qhmap_hash( p_table, p_slot->key )) &
+			p_table->mask) < dist )
+		{
+			return( NULL );
+		}
+	}
+}
+/*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_get
+* NAME
+*	cl_qhmap_get
+*
+* DESCRIPTION
+*	The cl_qhmap_get function returns the map item associated with a key.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_hmap_item_t* CL_API
+cl_qhmap_get(
+	IN	const cl_qhmap_t* const	p_map,
+	IN	const uint64_t			key )
+{
+	cl_hmap_item_t	*p_item;
+
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+
+	p_item = __cl_qhmap_find( &p_map->table, key );
+	if( !p_item )
+		p_item = __cl_qhmap_find( &p_map->old_table, key );
+
+	return( p_item );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure from which to retrieve the
+*		item with the specified key.
+*
+*	key
+*		[in] Key value used to search for the desired map item.
+*
+* RETURN VALUES
+*	Pointer to the map item with the desired key value.
+*
+*	NULL if there was no item with the desired key value stored in the map.
+*
+* NOTES
+*	cl_qhmap_get does not remove the item from the map, and never migrates
+*	slots, so it can be called concurrently with other lookups.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_remove
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_insert
+* NAME
+*	cl_qhmap_insert
+*
+* DESCRIPTION
+*	The cl_qhmap_insert function inserts a map item into a quick hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_hmap_item_t* CL_API
+cl_qhmap_insert(
+	IN	cl_qhmap_t* const		p_map,
+	IN	const uint64_t			key,
+	IN	cl_hmap_item_t* const	p_item );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure into which to add the item.
+*
+*	key
+*		[in] Value to assign to the item.
+*
+*	p_item
+*		[in] Pointer to a cl_hmap_item_t stucture to insert into the map.
+*
+* RETURN VALUES
+*	Pointer to the item in the map with the specified key.  If insertion
+*	was successful, this is the pointer to the item.  If an item with the
+*	specified key already exists in the map, the pointer to that item is
+*	returned.
+*
+*	NULL if the table needed to grow and there was not enough memory to
+*	allocate a larger table.
+*
+* NOTES
+*	Insertion may start growing the map, or migrate up to
+*	CL_QHMAP_REHASH_SLOTS slots of a growth already in progress.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_remove, cl_hmap_item_t
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_remove_item
+* NAME
+*	cl_qhmap_remove_item
+*
+* DESCRIPTION
+*	The cl_qhmap_remove_item function removes the specified map item
+*	from a quick hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_qhmap_remove_item(
+	IN	cl_qhmap_t* const		p_map,
+	IN	cl_hmap_item_t* const	p_item );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure from which to remove the item.
+*
+*	p_item
+*		[in] Pointer to a map item to remove from its map.
+*
+* RETURN VALUES
+*	This function does not return a value.
+*
+*	In a debug build, cl_qhmap_remove_item asserts that the item being
+*	removed is in the specified map.
+*
+* NOTES
+*	Removal shifts the following items of the probe sequence back by one
+*	slot instead of leaving a tombstone, so lookups do not degrade after
+*	many removals.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_remove, cl_qhmap_remove_all, cl_qhmap_insert
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_remove
+* NAME
+*	cl_qhmap_remove
+*
+* DESCRIPTION
+*	The cl_qhmap_remove function removes the map item with the specified key
+*	from a quick hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_hmap_item_t* CL_API
+cl_qhmap_remove(
+	IN	cl_qhmap_t* const	p_map,
+	IN	const uint64_t		key );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure from which to remove the item
+*		with the specified key.
+*
+*	key
+*		[in] Key value used to search for the map item to remove.
+*
+* RETURN VALUES
+*	Pointer to the removed map item if it was found.
+*
+*	NULL if no item with the specified key exists in the map.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_remove_item, cl_qhmap_remove_all,
+*	cl_qhmap_insert
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_remove_all
+* NAME
+*	cl_qhmap_remove_all
+*
+* DESCRIPTION
+*	The cl_qhmap_remove_all function removes all items in a quick hash map,
+*	leaving it empty.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_qhmap_remove_all(
+	IN	cl_qhmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure to empty.
+*
+* RETURN VALUES
+*	This function does not return a value.
+*
+* NOTES
+*	Any growth in progress is abandoned and the old table freed.  The
+*	current table keeps its size.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_qhmap_remove, cl_qhmap_remove_item
+*********/
+
+
+/****f* Component Library: Quick Hash Map/cl_qhmap_apply_func
+* NAME
+*	cl_qhmap_apply_func
+*
+* DESCRIPTION
+*	The cl_qhmap_apply_func function executes a specified function
+*	for every item stored in a quick hash map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_qhmap_apply_func(
+	IN	const cl_qhmap_t* const	p_map,
+	IN	cl_pfn_qhmap_apply_t	pfn_func,
+	IN	const void* const		context );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qhmap_t structure.
+*
+*	pfn_func
+*		[in] Function invoked for every item in the map.
+*		See the cl_pfn_qhmap_apply_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback functions to provide context.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Items are visited in table order, not in key order.
+*
+*	The function provided must not perform any map operations, as these
+*	would corrupt the quick hash map.
+*
+* SEE ALSO
+*	Quick Hash Map, cl_pfn_qhmap_apply_t
+*********/
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif	/* _CL_QHMAP_H_ */
@@ -96,6 +96,9 @@
 *		cl_qlist_find_from_head, cl_qlist_find_from_tail
 *		cl_qlist_apply_func, cl_qlist_move_items
 *
+*	Partitioning:
+*		cl_qlist_split_n, cl_qlist_parallel_apply
+*
 *	Attributes:
 *		cl_qlist_count, cl_is_qlist_empty
 *********/
@@ -1749,6 +1752,57 @@ cl_qlist_move_items(
 *********/
 
 
+/****f* Component Library: Quick List/cl_qlist_split_n
+* NAME
+*	cl_qlist_split_n
+*
+* DESCRIPTION
+*	The cl_qlist_split_n function moves all list items of a quick list into
+*	an array of quick lists of balanced length.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_qlist_split_n(
+	IN	cl_qlist_t* const	p_src_list,
+	IN	cl_qlist_t* const	p_dest_lists,
+	IN	const uint32_t		n );
+/*
+* PARAMETERS
+*	p_src_list
+*		[in] Pointer to a cl_qlist_t structure from which all list items
+*		are removed.
+*
+*	p_dest_lists
+*		[in] Array of n initialized cl_qlist_t structures to which the
+*		source list items are added.
+*
+*	n
+*		[in] Number of entries in the p_dest_lists array.  Must be
+*		at least one.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The source list is cut into n consecutive slices, in order, and each
+*	slice is appended to the tail of the destination list of the same
+*	index.  The first count % n slices hold one more item than the others.
+*	If the source list holds fewer than n items, the trailing destination
+*	lists receive no items.
+*
+*	The slice boundaries are found with a single walk of the source list,
+*	after which each slice is moved in constant time.  In debug builds,
+*	each moved item is also updated to reference its new list.
+*
+*	Appending the destination lists back to a single list in index order
+*	with cl_qlist_insert_list_tail restores the original ordering.
+*
+* SEE ALSO
+*	Quick List, cl_qlist_insert_list_tail, cl_qlist_parallel_apply
+*********/
+
+
 #ifdef __cplusplus
 }	/* extern "C" */
 #endif
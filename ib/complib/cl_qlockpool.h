@@ -56,6 +56,9 @@
 * DESCRIPTION
 *	The Quick Locking Pool represents a thread-safe quick pool.
 *
+*	All threads share a single lock.  Pools used heavily by many threads
+*	should use a Magazine Cache or a Lock-Free Quick Pool instead.
+*
 *	This object should be treated as opaque and should be
 *	manipulated only through the provided functions.
 *
@@ -88,10 +88,15 @@
 *
 *	Manipulation:
 *		cl_qmap_insert, cl_qmap_get, cl_qmap_remove_item, cl_qmap_remove,
-*		cl_qmap_remove_all, cl_qmap_merge, cl_qmap_delta
+*		cl_qmap_remove_all, cl_qmap_merge, cl_qmap_delta,
+*		cl_qmap_build_sorted
 *
 *	Search:
-*		cl_qmap_apply_func
+*		cl_qmap_apply_func, cl_qmap_lower_bound, cl_qmap_upper_bound,
+*		cl_qmap_equal_range, cl_qmap_range
+*
+*	Range Iteration:
+*		cl_qmap_range_t, cl_qmap_range_init, cl_qmap_range_next
 *
 *	Attributes:
 *		cl_qmap_count, cl_is_qmap_empty,
@@ -251,6 +256,41 @@ typedef struct _cl_qmap
 *********/
 
 
+/****s* Component Library: Quick Map/cl_qmap_range_t
+* NAME
+*	cl_qmap_range_t
+*
+* DESCRIPTION
+*	Iterator over the items of a quick map whose keys fall in a range.
+*
+*	The cl_qmap_range_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_qmap_range
+{
+	const struct _cl_qmap	*p_map;
+	cl_map_item_t			*p_item;
+	uint64_t				high;
+
+} cl_qmap_range_t;
+/*
+* FIELDS
+*	p_map
+*		Map being iterated.
+*
+*	p_item
+*		Next item to return.
+*
+*	high
+*		Highest key included in the range.
+*
+* SEE ALSO
+*	Quick Map, cl_qmap_range_init, cl_qmap_range_next
+*********/
+
+
 /****d* Component Library: Quick Map/cl_pfn_qmap_apply_t
 * NAME
 *	cl_pfn_qmap_apply_t
@@ -700,6 +740,58 @@ cl_qmap_insert(
 *********/
 
 
+/****f* Component Library: Quick Map/cl_qmap_build_sorted
+* NAME
+*	cl_qmap_build_sorted
+*
+* DESCRIPTION
+*	The cl_qmap_build_sorted function builds a balanced quick map from an
+*	array of items with strictly increasing keys.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_qmap_build_sorted(
+	IN	cl_qmap_t* const			p_map,
+	IN	const uint64_t* const		p_keys,
+	IN	cl_map_item_t* const* const	pp_items,
+	IN	const size_t				count );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to an empty cl_qmap_t structure into which to add
+*		the items.
+*
+*	p_keys
+*		[in] Array of keys to assign to the items, in strictly increasing
+*		order.
+*
+*	pp_items
+*		[in] Array of pointers to the cl_map_item_t structures to insert.
+*		pp_items[i] is assigned the key p_keys[i].
+*
+*	count
+*		[in] Number of entries in the p_keys and pp_items arrays.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The map must be empty on input.
+*
+*	The tree and the ordered item list are built in O(count) time, without
+*	the per item search and rebalancing performed by cl_qmap_insert.  This
+*	is the preferred way to load a map from a sorted source such as an SA
+*	table dump or a forwarding table snapshot.
+*
+*	In a debug build, cl_qmap_build_sorted asserts that the keys are
+*	strictly increasing.
+*
+* SEE ALSO
+*	Quick Map, cl_qmap_insert, cl_qmap_remove_all, cl_rbmap_build_sorted
+*********/
+
+
 /****f* Component Library: Quick Map/cl_qmap_get
 * NAME
 *	cl_qmap_get
@@ -736,6 +828,290 @@ cl_qmap_get(
 *********/
 
 
+/****f* Component Library: Quick Map/cl_qmap_lower_bound
+* NAME
+*	cl_qmap_lower_bound
+*
+* DESCRIPTION
+*	The cl_qmap_lower_bound function returns the map item with the lowest
+*	key greater than or equal to a specified key.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_map_item_t* CL_API
+cl_qmap_lower_bound(
+	IN	const cl_qmap_t* const	p_map,
+	IN	const uint64_t			key );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qmap_t structure to search.
+*
+*	key
+*		[in] Key value to search for.
+*
+* RETURN VALUES
+*	Pointer to the first map item whose key is greater than or equal to key.
+*
+*	Pointer to the map end if all keys in the map are lower than key.
+*
+* NOTES
+*	The search descends the tree once, discarding every subtree that lies
+*	entirely below key, and completes in O(log n) time.
+*
+* SEE ALSO
+*	Quick Map, cl_qmap_upper_bound, cl_qmap_range, cl_qmap_range_init
+*********/
+
+
+/****f* Component Library: Quick Map/cl_qmap_upper_bound
+* NAME
+*	cl_qmap_upper_bound
+*
+* DESCRIPTION
+*	The cl_qmap_upper_bound function returns the map item with the lowest
+*	key strictly greater than a specified key.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_map_item_t* CL_API
+cl_qmap_upper_bound(
+	IN	const cl_qmap_t* const	p_map,
+	IN	const uint64_t			key );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qmap_t structure to search.
+*
+*	key
+*		[in] Key value to search for.
+*
+* RETURN VALUES
+*	Pointer to the first map item whose key is greater than key.
+*
+*	Pointer to the map end if no key in the map is greater than key.
+*
+* SEE ALSO
+*	Quick Map, cl_qmap_lower_bound, cl_qmap_range
+*********/
+
+
+/****f* Component Library: Quick Map/cl_qmap_equal_range
+* NAME
+*	cl_qmap_equal_range
+*
+* DESCRIPTION
+*	The cl_qmap_equal_range function returns the bounds of the items in a
+*	quick map whose key equals a specified key.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_qmap_equal_range(
+	IN	const cl_qmap_t* const	p_map,
+	IN	const uint64_t			key,
+	OUT	cl_map_item_t** const	pp_first,
+	OUT	cl_map_item_t** const	pp_end )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( pp_first );
+	CL_ASSERT( pp_end );
+
+	*pp_first = cl_qmap_lower_bound( p_map, key );
+	*pp_end = cl_qmap_upper_bound( p_map, key );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qmap_t structure to search.
+*
+*	key
+*		[in] Key value to search for.
+*
+*	pp_first
+*		[out] First item in the range, or the item at pp_end if the range
+*		is empty.
+*
+*	pp_end
+*		[out] First item past the range, which may be the map end.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Keys in a quick map are unique, so the range holds at most one item.
+*	The function is provided for symmetry with cl_fmap_equal_range and
+*	cl_rbmap_equal_range.  Use cl_qmap_range to find the items whose keys
+*	lie between two bounds.
+*
+*	Walk the range with cl_qmap_next until reaching *pp_end.  The bounds
+*	are invalidated by any insertion or removal.
+*
+* SEE ALSO
+*	Quick Map, cl_qmap_lower_bound, cl_qmap_upper_bound, cl_qmap_range
+*********/
+
+
+/****f* Component Library: Quick Map/cl_qmap_range
+* NAME
+*	cl_qmap_range
+*
+* DESCRIPTION
+*	The cl_qmap_range function returns the bounds of the items in a
+*	quick map whose keys lie in an inclusive range.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_qmap_range(
+	IN	const cl_qmap_t* const	p_map,
+	IN	const uint64_t			low,
+	IN	const uint64_t			high,
+	OUT	cl_map_item_t** const	pp_first,
+	OUT	cl_map_item_t** const	pp_end )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( pp_first );
+	CL_ASSERT( pp_end );
+	CL_ASSERT( low <= high );
+
+	*pp_first = cl_qmap_lower_bound( p_map, low );
+	*pp_end = cl_qmap_upper_bound( p_map, high );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_qmap_t structure to search.
+*
+*	low
+*		[in] Lowest key of the range.
+*
+*	high
+*		[in] Highest key of the range.
+*
+*	pp_first
+*		[out] First item in the range, or the item at pp_end if the range
+*		is empty.
+*
+*	pp_end
+*		[out] First item past the range, which may be the map end.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Walk the range with cl_qmap_next until reaching *pp_end.  The bounds
+*	are invalidated by any insertion or removal.
+*
+*	The range is inclusive so that the highest possible key can be
+*	included.  A half open range [a, b) with b > a is [a, b - 1].
+*
+* SEE ALSO
+*	Quick Map, cl_qmap_equal_range, cl_qmap_range_init
+*********/
+
+
+/****f* Component Library: Quick Map/cl_qmap_range_init
+* NAME
+*	cl_qmap_range_init
+*
+* DESCRIPTION
+*	The cl_qmap_range_init function positions a range iterator on the first
+*	item of a quick map whose key lies in an inclusive range.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_qmap_range_init(
+	OUT	cl_qmap_range_t* const	p_range,
+	IN	const cl_qmap_t* const	p_map,
+	IN	const uint64_t			low,
+	IN	const uint64_t			high )
+{
+	CL_ASSERT( p_range );
+	CL_ASSERT( p_map );
+	CL_ASSERT( low <= high );
+
+	p_range->p_map = p_map;
+	p_range->p_item = cl_qmap_lower_bound( p_map, low );
+	p_range->high = high;
+}
+/*
+* PARAMETERS
+*	p_range
+*		[out] Pointer to a cl_qmap_range_t structure to initialize.
+*
+*	p_map
+*		[in] Pointer to the cl_qmap_t structure to iterate.
+*
+*	low
+*		[in] Lowest key of the range.
+*
+*	high
+*		[in] Highest key of the range.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Positioning costs one O(log n) descent that skips every subtree below
+*	low.  Each following item is reached through the map's ordered list and
+*	iteration stops at the first key above high, so a scan costs
+*	O(log n + k) for k items in range.
+*
+* SEE ALSO
+*	Quick Map, cl_qmap_range_t, cl_qmap_range_next
+*********/
+
+
+/****f* Component Library: Quick Map/cl_qmap_range_next
+* NAME
+*	cl_qmap_range_next
+*
+* DESCRIPTION
+*	The cl_qmap_range_next function returns the next item of a range
+*	iteration.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_map_item_t* CL_API
+cl_qmap_range_next(
+	IN OUT	cl_qmap_range_t* const	p_range )
+{
+	cl_map_item_t	*p_item;
+
+	CL_ASSERT( p_range );
+
+	p_item = p_range->p_item;
+	if( p_item == cl_qmap_end( p_range->p_map ) ||
+		p_item->key > p_range->high )
+	{
+		return( NULL );
+	}
+
+	p_range->p_item = cl_qmap_next( p_item );
+	return( p_item );
+}
+/*
+* PARAMETERS
+*	p_range
+*		[in/out] Pointer to a range iterator initialized by
+*		cl_qmap_range_init.
+*
+* RETURN VALUES
+*	Pointer to the next map item in the range, in ascending key order.
+*
+*	NULL once all items in the range have been returned.
+*
+* NOTES
+*	The returned item may be removed from the map before the next call.
+*	Any other insertion or removal invalidates the iterator.
+*
+* SEE ALSO
+*	Quick Map, cl_qmap_range_t, cl_qmap_range_init
+*********/
+
+
 /****f* Component Library: Quick Map/cl_qmap_remove_item
 * NAME
 *	cl_qmap_remove_item
@@ -870,6 +1246,10 @@ cl_qmap_merge(
 *	Upon return from cl_qmap_merge, the quick map referenced by p_src_map
 *	contains all duplicate items.
 *
+*	Both maps are walked once in key order, so the merge completes in
+*	O(n + m) time.  The destination tree is rebuilt from the merged item
+*	list as with cl_qmap_build_sorted instead of rebalancing per item.
+*
 * SEE ALSO
 *	Quick Map, cl_qmap_delta
 *********/
@@ -921,6 +1301,10 @@ cl_qmap_delta(
 *	Both maps pointed to by p_new and p_old must be empty on input.  This
 *	requirement removes the possibility of failures.
 *
+*	p_map1 and p_map2 are walked once in key order and all four trees are
+*	rebuilt from their item lists, so the delta completes in O(n + m) time
+*	rather than performing a lookup per item.
+*
 * SEE ALSO
 *	Quick Map, cl_qmap_merge
 *********/
@@ -83,7 +83,7 @@
 *		cl_pfn_qpool_init_t, cl_pfn_qpool_dtor_t
 *
 *	Initialization/Destruction:
-*		cl_qpool_construct, cl_qpool_init, cl_qpool_destroy
+*		cl_qpool_construct, cl_qpool_init, cl_qpool_init_ex, cl_qpool_destroy
 *
 *	Manipulation:
 *		cl_qpool_get, cl_qpool_put, cl_qpool_put_list, cl_qpool_grow
@@ -393,6 +393,47 @@ cl_qpool_init(
 *********/
 
 
+/****f* Component Library: Quick Pool/cl_qpool_init_ex
+* NAME
+*	cl_qpool_init_ex
+*
+* DESCRIPTION
+*	The cl_qpool_init_ex function initializes a quick pool for use, with
+*	an allocation policy.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_qpool_init_ex(
+	IN	cl_qpool_t* const		p_pool,
+	IN	const size_t			min_size,
+	IN	const size_t			max_size,
+	IN	const size_t			grow_size,
+	IN	const size_t			object_size,
+	IN	const cl_mem_policy_t* const	p_policy OPTIONAL,
+	IN	cl_pfn_qpool_init_t		pfn_initializer OPTIONAL,
+	IN	cl_pfn_qpool_dtor_t		pfn_destructor OPTIONAL,
+	IN	const void* const		context );
+/*
+* PARAMETERS
+*	p_policy
+*		[in] Allocation policy used whenever the pool grows.  The policy is
+*		copied into the pool.  If NULL, the pool allocates from the system
+*		heap, as with cl_qpool_init.
+*
+*	Other parameters are the same as those of cl_qpool_init.
+*
+* RETURN VALUES
+*	Same as cl_qpool_init.
+*
+*	CL_INSUFFICIENT_MEMORY is also returned if the policy requires large
+*	pages and none are available.
+*
+* SEE ALSO
+*	Quick Pool, cl_qpool_init, cl_mem_policy_t
+*********/
+
+
 /****f* Component Library: Quick Pool/cl_qpool_destroy
 * NAME
 *	cl_qpool_destroy
@@ -74,10 +74,17 @@ use of the Software.
 *
 *	Manipulation:
 *		cl_rbmap_insert, cl_rbmap_get, cl_rbmap_remove_item, cl_rbmap_remove,
-*		cl_rbmap_reset, cl_rbmap_merge, cl_rbmap_delta
+*		cl_rbmap_reset, cl_rbmap_merge, cl_rbmap_delta, cl_rbmap_build_sorted
 *
 *	Search:
-*		cl_rbmap_apply_func
+*		cl_rbmap_apply_func, cl_rbmap_lower_bound, cl_rbmap_upper_bound,
+*		cl_rbmap_equal_range
+*
+*	Range Iteration:
+*		cl_rbmap_range_t, cl_rbmap_range_init, cl_rbmap_range_next
+*
+*	Order Statistics:
+*		cl_rbmap_enable_rank, cl_rbmap_select, cl_rbmap_rank
 *
 *	Attributes:
 *		cl_rbmap_count, cl_is_rbmap_empty,
@@ -131,6 +138,7 @@ typedef struct _cl_rbmap_item
 	struct _cl_rbmap_item		*p_right;
 	struct _cl_rbmap_item		*p_up;
 	cl_map_color_t				color;
+	uint32_t					size;
 #ifdef _DEBUG_
 	struct _cl_rbmap			*p_map;
 #endif
@@ -150,11 +158,21 @@ typedef struct _cl_rbmap_item
 *	color
 *		Indicates whether a node is red or black in the map.
 *
+*	size
+*		Number of items in the subtree rooted at the node, including the
+*		node itself.  Only maintained in maps with rank tracking enabled.
+*
 * NOTES
 *	None of the fields of this structure should be manipulated by users, as
 *	they are crititcal to the proper operation of the map in which they
 *	are stored.
 *
+*	The size field occupies what would otherwise be structure padding on
+*	64-bit platforms, where the layout of the item is unchanged.  On 32-bit
+*	platforms there is no such padding, and the field grows the item by
+*	four bytes.  32-bit clients embedding cl_rbmap_item_t must therefore be
+*	rebuilt against this header before using a library that includes it.
+*
 *	To allow storing items in either a quick list, a quick pool, or a quick
 *	map, the map implementation guarantees that the map item can be safely
 *	cast to a pool item used for storing an object in a quick pool, or cast to
@@ -185,6 +203,7 @@ typedef struct _cl_rbmap
 	cl_rbmap_item_t	nil;
 	cl_state_t		state;
 	size_t			count;
+	boolean_t		track_rank;
 
 } cl_rbmap_t;
 /*
@@ -205,8 +224,86 @@ typedef struct _cl_rbmap
 *	count
 *		Number of items in the map.
 *
+*	track_rank
+*		TRUE if the map maintains subtree sizes in its items.
+*
 * SEE ALSO
-*	RB Map
+*	RB Map, cl_rbmap_enable_rank
+*********/
+
+
+/****d* Component Library: RB Map/cl_pfn_rbmap_cmp_t
+* NAME
+*	cl_pfn_rbmap_cmp_t
+*
+* DESCRIPTION
+*	The cl_pfn_rbmap_cmp_t function type defines the prototype for functions
+*	used to compare a search key with the key of an item in a RB map.
+*
+* SYNOPSIS
+*/
+typedef int
+(CL_API *cl_pfn_rbmap_cmp_t)(
+	IN	const void* const				p_key,
+	IN	const cl_rbmap_item_t* const	p_item );
+/*
+* PARAMETERS
+*	p_key
+*		[in] Pointer to the search key.
+*
+*	p_item
+*		[in] Pointer to the item whose key to compare against.
+*
+* RETURN VALUE
+*	Returns 0 if the key matches the item.
+*	Returns less than 0 if the key is lower than the item's key.
+*	Returns greater than 0 if the key is greater than the item's key.
+*
+* NOTES
+*	RB map does not store keys, so range searches rely on this function to
+*	locate the item's key, typically through PARENT_STRUCT.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_lower_bound, cl_rbmap_upper_bound, cl_rbmap_range_init
+*********/
+
+
+/****s* Component Library: RB Map/cl_rbmap_range_t
+* NAME
+*	cl_rbmap_range_t
+*
+* DESCRIPTION
+*	Iterator over the items of a RB map whose keys fall in a range.
+*
+*	The cl_rbmap_range_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_rbmap_range
+{
+	const cl_rbmap_t		*p_map;
+	cl_rbmap_item_t			*p_item;
+	const void				*p_high;
+	cl_pfn_rbmap_cmp_t		pfn_compare;
+
+} cl_rbmap_range_t;
+/*
+* FIELDS
+*	p_map
+*		Map being iterated.
+*
+*	p_item
+*		Next item to return.
+*
+*	p_high
+*		Highest key included in the range.
+*
+*	pfn_compare
+*		Compare function used to locate and bound the range.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_range_init, cl_rbmap_range_next
 *********/
 
 
@@ -332,12 +429,14 @@ cl_rbmap_init(
 	p_map->root.p_right = &p_map->nil;
 	p_map->root.p_up = &p_map->root;
 	p_map->root.color = CL_MAP_BLACK;
+	p_map->root.size = 0;
 
 	/* Setup the node used as terminator for all leaves. */
 	p_map->nil.p_left = &p_map->nil;
 	p_map->nil.p_right = &p_map->nil;
 	p_map->nil.p_up = &p_map->nil;
 	p_map->nil.color = CL_MAP_BLACK;
+	p_map->nil.size = 0;
 
 #ifdef _DEBUG_
 	p_map->root.p_map = p_map;
@@ -347,6 +446,7 @@ cl_rbmap_init(
 	p_map->state = CL_INITIALIZED;
 
 	p_map->count = 0;
+	p_map->track_rank = FALSE;
 }
 /*
 * PARAMETERS
@@ -364,6 +464,48 @@ cl_rbmap_init(
 *********/
 
 
+/****f* Component Library: RB Map/cl_rbmap_enable_rank
+* NAME
+*	cl_rbmap_enable_rank
+*
+* DESCRIPTION
+*	The cl_rbmap_enable_rank function enables order statistics on an empty
+*	RB map.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_rbmap_enable_rank(
+	IN	cl_rbmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	CL_ASSERT( !p_map->count );
+
+	p_map->track_rank = TRUE;
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to an empty cl_rbmap_t structure.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Once enabled, every item stores the size of its subtree.  Insertion and
+*	removal update the sizes along the path to the root, adding O(log n)
+*	work, in exchange for O(log n) cl_rbmap_select and cl_rbmap_rank.
+*	Maps that never call these should leave rank tracking disabled.
+*
+*	Must be called after cl_rbmap_init and before the first insertion.
+*	cl_rbmap_reset keeps rank tracking enabled.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_select, cl_rbmap_rank
+*********/
+
+
 /****f* Component Library: RB Map/cl_rbmap_root
 * NAME
 *	cl_rbmap_root
@@ -547,6 +689,9 @@ cl_rbmap_insert(
 * NOTES
 *	Insertion operations may cause the RB map to rebalance.
 *
+*	If rank tracking is enabled, the subtree sizes of all ancestors of
+*	p_item are incremented and the sizes of rotated items recomputed.
+*
 * SEE ALSO
 *	RB Map, cl_rbmap_remove, cl_rbmap_item_t
 *********/
@@ -580,11 +725,460 @@ cl_rbmap_remove_item(
 * NOTES
 *	Removes the map item pointed to by p_item from its RB map.
 *
+*	If rank tracking is enabled, the subtree sizes of the affected
+*	ancestors are decremented.
+*
 * SEE ALSO
 *	RB Map, cl_rbmap_remove, cl_rbmap_reset, cl_rbmap_insert
 *********/
 
 
+/****f* Component Library: RB Map/cl_rbmap_next
+* NAME
+*	cl_rbmap_next
+*
+* DESCRIPTION
+*	The cl_rbmap_next function returns the item that follows a specified
+*	item in key order.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_rbmap_item_t* CL_API
+cl_rbmap_next(
+	IN	const cl_rbmap_t* const			p_map,
+	IN	const cl_rbmap_item_t* const	p_item );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to the cl_rbmap_t structure containing the item.
+*
+*	p_item
+*		[in] Pointer to a map item whose successor to return.
+*
+* RETURN VALUES
+*	Pointer to the map item with the next higher key.
+*
+*	Pointer to the map end if p_item has the highest key in the map.
+*
+* NOTES
+*	The successor is the leftmost item of the right subtree, or else the
+*	first ancestor reached from a left child.  A full walk of the map costs
+*	O(n) in total.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_end, cl_rbmap_range_next
+*********/
+
+
+/****f* Component Library: RB Map/cl_rbmap_lower_bound
+* NAME
+*	cl_rbmap_lower_bound
+*
+* DESCRIPTION
+*	The cl_rbmap_lower_bound function returns the first map item whose key
+*	is not less than a specified key.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_rbmap_item_t* CL_API
+cl_rbmap_lower_bound(
+	IN	const cl_rbmap_t* const	p_map,
+	IN	const void* const		p_key,
+	IN	cl_pfn_rbmap_cmp_t		pfn_compare );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rbmap_t structure to search.
+*
+*	p_key
+*		[in] Pointer to a key value to search for.
+*
+*	pfn_compare
+*		[in] Function used to compare p_key with the items of the map.
+*		It may report keys as equal at a coarser granularity than the
+*		map's ordering, as long as it is consistent with it.
+*
+* RETURN VALUES
+*	Pointer to the first map item whose key does not compare lower than
+*	p_key.
+*
+*	Pointer to the map end if every key in the map compares lower.
+*
+* NOTES
+*	The search descends the tree once, discarding every subtree that lies
+*	entirely below p_key.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_upper_bound, cl_rbmap_equal_range, cl_pfn_rbmap_cmp_t
+*********/
+
+
+/****f* Component Library: RB Map/cl_rbmap_upper_bound
+* NAME
+*	cl_rbmap_upper_bound
+*
+* DESCRIPTION
+*	The cl_rbmap_upper_bound function returns the first map item whose key
+*	compares greater than a specified key.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_rbmap_item_t* CL_API
+cl_rbmap_upper_bound(
+	IN	const cl_rbmap_t* const	p_map,
+	IN	const void* const		p_key,
+	IN	cl_pfn_rbmap_cmp_t		pfn_compare );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rbmap_t structure to search.
+*
+*	p_key
+*		[in] Pointer to a key value to search for.
+*
+*	pfn_compare
+*		[in] Function used to compare p_key with the items of the map.
+*
+* RETURN VALUES
+*	Pointer to the first map item whose key compares greater than p_key.
+*
+*	Pointer to the map end if no key in the map compares greater.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_lower_bound, cl_rbmap_equal_range
+*********/
+
+
+/****f* Component Library: RB Map/cl_rbmap_equal_range
+* NAME
+*	cl_rbmap_equal_range
+*
+* DESCRIPTION
+*	The cl_rbmap_equal_range function returns the bounds of the items in a
+*	RB map whose keys compare equal to a specified key.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_rbmap_equal_range(
+	IN	const cl_rbmap_t* const		p_map,
+	IN	const void* const			p_key,
+	IN	cl_pfn_rbmap_cmp_t			pfn_compare,
+	OUT	cl_rbmap_item_t** const		pp_first,
+	OUT	cl_rbmap_item_t** const		pp_end )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( pp_first );
+	CL_ASSERT( pp_end );
+
+	*pp_first = cl_rbmap_lower_bound( p_map, p_key, pfn_compare );
+	*pp_end = cl_rbmap_upper_bound( p_map, p_key, pfn_compare );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rbmap_t structure to search.
+*
+*	p_key
+*		[in] Pointer to a key value to search for.
+*
+*	pfn_compare
+*		[in] Function used to compare p_key with the items of the map.
+*
+*	pp_first
+*		[out] First item in the range, or the item at pp_end if the range
+*		is empty.
+*
+*	pp_end
+*		[out] First item past the range, which may be the map end.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Walk the range with cl_rbmap_next until reaching *pp_end.  The bounds
+*	are invalidated by any insertion or removal.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_lower_bound, cl_rbmap_upper_bound, cl_rbmap_next
+*********/
+
+
+/****f* Component Library: RB Map/cl_rbmap_range_init
+* NAME
+*	cl_rbmap_range_init
+*
+* DESCRIPTION
+*	The cl_rbmap_range_init function positions a range iterator on the first
+*	item of a RB map whose key lies in an inclusive range.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_rbmap_range_init(
+	OUT	cl_rbmap_range_t* const	p_range,
+	IN	const cl_rbmap_t* const	p_map,
+	IN	const void* const		p_low,
+	IN	const void* const		p_high,
+	IN	cl_pfn_rbmap_cmp_t		pfn_compare )
+{
+	CL_ASSERT( p_range );
+	CL_ASSERT( p_map );
+	CL_ASSERT( pfn_compare );
+
+	p_range->p_map = p_map;
+	p_range->pfn_compare = pfn_compare;
+	p_range->p_item = cl_rbmap_lower_bound( p_map, p_low, pfn_compare );
+	p_range->p_high = p_high;
+}
+/*
+* PARAMETERS
+*	p_range
+*		[out] Pointer to a cl_rbmap_range_t structure to initialize.
+*
+*	p_map
+*		[in] Pointer to the cl_rbmap_t structure to iterate.
+*
+*	p_low
+*		[in] Pointer to the lowest key of the range.
+*
+*	p_high
+*		[in] Pointer to the highest key of the range.  The key must remain
+*		valid for the life of the iterator.
+*
+*	pfn_compare
+*		[in] Function used to compare keys with the items of the map.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Positioning skips every subtree below p_low, and iteration stops at the
+*	first item above p_high, so subtrees on either side of the range are
+*	never visited.  A scan of k items costs O(log n + k).
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_range_t, cl_rbmap_range_next
+*********/
+
+
+/****f* Component Library: RB Map/cl_rbmap_range_next
+* NAME
+*	cl_rbmap_range_next
+*
+* DESCRIPTION
+*	The cl_rbmap_range_next function returns the next item of a range
+*	iteration.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_rbmap_item_t* CL_API
+cl_rbmap_range_next(
+	IN OUT	cl_rbmap_range_t* const	p_range )
+{
+	cl_rbmap_item_t	*p_item;
+
+	CL_ASSERT( p_range );
+
+	p_item = p_range->p_item;
+	if( p_item == cl_rbmap_end( p_range->p_map ) ||
+		p_range->pfn_compare( p_range->p_high, p_item ) < 0 )
+	{
+		return( NULL );
+	}
+
+	p_range->p_item = cl_rbmap_next( p_range->p_map, p_item );
+	return( p_item );
+}
+/*
+* PARAMETERS
+*	p_range
+*		[in/out] Pointer to a range iterator initialized by
+*		cl_rbmap_range_init.
+*
+* RETURN VALUES
+*	Pointer to the next map item in the range, in ascending key order.
+*
+*	NULL once all items in the range have been returned.
+*
+* NOTES
+*	Any insertion or removal invalidates the iterator.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_range_t, cl_rbmap_range_init
+*********/
+
+
+/****f* Component Library: RB Map/cl_rbmap_select
+* NAME
+*	cl_rbmap_select
+*
+* DESCRIPTION
+*	The cl_rbmap_select function returns the item at a given position in
+*	key order.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_rbmap_item_t* CL_API
+cl_rbmap_select(
+	IN	const cl_rbmap_t* const	p_map,
+	IN	size_t					index )
+{
+	cl_rbmap_item_t	*p_item;
+	size_t			left_size;
+
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	CL_ASSERT( p_map->track_rank );
+
+	if( index >= p_map->count )
+		return( (cl_rbmap_item_t*)&p_map->nil );
+
+	p_item = p_map->root.p_left;
+	for( ;; )
+	{
+		/* The nil item has a size of zero. */
+		left_size = p_item->p_left->size;
+		if( index == left_size )
+			return( p_item );
+
+		if( index < left_size )
+		{
+			p_item = p_item->p_left;
+		}
+		else
+		{
+			index -= left_size + 1;
+			p_item = p_item->p_right;
+		}
+	}
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rbmap_t structure with rank tracking enabled.
+*
+*	index
+*		[in] Zero based position of the item to return.
+*
+* RETURN VALUES
+*	Pointer to the item with exactly index items ordered before it.
+*
+*	Pointer to the map end if index is not less than the number of items
+*	in the map.
+*
+* NOTES
+*	cl_rbmap_select completes in O(log n) time.  To return a page of
+*	items, select the first one and walk the rest with cl_rbmap_next.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_enable_rank, cl_rbmap_rank, cl_rbmap_next
+*********/
+
+
+/****f* Component Library: RB Map/cl_rbmap_rank
+* NAME
+*	cl_rbmap_rank
+*
+* DESCRIPTION
+*	The cl_rbmap_rank function returns the position of an item in key order.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_rbmap_rank(
+	IN	const cl_rbmap_t* const			p_map,
+	IN	const cl_rbmap_item_t* const	p_item )
+{
+	const cl_rbmap_item_t	*p_cur;
+	size_t					rank;
+
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	CL_ASSERT( p_map->track_rank );
+	CL_ASSERT( p_item != &p_map->nil );
+
+	rank = p_item->p_left->size;
+	for( p_cur = p_item; p_cur->p_up != &p_map->root; p_cur = p_cur->p_up )
+	{
+		/*
+		 * Coming up from a right child, the parent and its left subtree
+		 * are ordered before the item.
+		 */
+		if( p_cur == p_cur->p_up->p_right )
+			rank += p_cur->p_up->p_left->size + 1;
+	}
+	return( rank );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rbmap_t structure with rank tracking enabled.
+*
+*	p_item
+*		[in] Pointer to an item stored in the map.
+*
+* RETURN VALUE
+*	Zero based number of items ordered before p_item.
+*
+* NOTES
+*	cl_rbmap_rank completes in O(log n) time.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_enable_rank, cl_rbmap_select
+*********/
+
+
+/****f* Component Library: RB Map/cl_rbmap_build_sorted
+* NAME
+*	cl_rbmap_build_sorted
+*
+* DESCRIPTION
+*	The cl_rbmap_build_sorted function builds a balanced RB map from an
+*	array of items that is already in key order.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_rbmap_build_sorted(
+	IN	cl_rbmap_t* const				p_map,
+	IN	cl_rbmap_item_t* const* const	pp_items,
+	IN	const size_t					count );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to an empty cl_rbmap_t structure into which to add
+*		the items.
+*
+*	pp_items
+*		[in] Array of pointers to the items to insert, ordered from the
+*		lowest key to the highest.
+*
+*	count
+*		[in] Number of entries in the pp_items array.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The map must be empty on input.
+*
+*	The tree is built in O(count) time by linking the middle item of each
+*	subarray as the root of its subtree, without any comparisons or
+*	rotations.  All levels are colored black except the last, partially
+*	filled one, whose items are colored red, which satisfies the RB map
+*	invariants for any count.
+*
+*	Since RB map does not store keys, the caller is responsible for the
+*	ordering of pp_items.  Items must not be stored in any other map.
+*
+*	If rank tracking is enabled, subtree sizes are set as the tree is built.
+*
+* SEE ALSO
+*	RB Map, cl_rbmap_insert, cl_rbmap_reset
+*********/
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,579 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of the read mostly flexi map, a flexi map whose lookups
+ *	run without locks against published snapshots.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_RCUFMAP_H_
+#define _CL_RCUFMAP_H_
+
+
+#include <complib/cl_fleximap.h>
+#include <complib/cl_epoch.h>
+
+
+/****h* Component Library/Read Mostly Flexi Map
+* NAME
+*	Read Mostly Flexi Map
+*
+* DESCRIPTION
+*	The read mostly flexi map wraps a flexi map for data that is looked up
+*	far more often than it changes, such as GID and service name tables.
+*
+*	Writers modify an ordinary flexi map and then publish it.  Publishing
+*	copies the item pointers, in key order, into a new immutable snapshot
+*	and atomically replaces the snapshot seen by readers.  The previous
+*	snapshot is retired to an epoch and freed once no reader can still be
+*	using it.
+*
+*	Readers enter the epoch, search the current snapshot with a binary
+*	search, and leave the epoch.  No lock is taken and no shared cache line
+*	is written, so lookups never serialize behind each other or behind a
+*	writer.
+*
+*	Since items are owned by the caller and cannot be copied, publishing is
+*	copy on write of the index rather than of the tree path, and costs
+*	O(n).  Writers that make several changes should publish once after the
+*	last change.
+*
+*	Writers must be serialized by the caller, as for flexi map.  Items
+*	removed from the map may still be referenced by readers until a grace
+*	period has passed; see cl_rcu_fmap_remove_item.
+*
+* SEE ALSO
+*	Structures:
+*		cl_rcu_fmap_t, cl_fmap_snap_t
+*
+*	Initialization:
+*		cl_rcu_fmap_construct, cl_rcu_fmap_init, cl_rcu_fmap_destroy
+*
+*	Readers:
+*		cl_rcu_fmap_get, cl_rcu_fmap_match, cl_rcu_fmap_count
+*
+*	Writers:
+*		cl_rcu_fmap_insert, cl_rcu_fmap_remove_item, cl_rcu_fmap_publish
+*
+*	Related:
+*		Flexi Map, Epoch
+*********/
+
+
+/****s* Component Library: Read Mostly Flexi Map/cl_fmap_snap_t
+* NAME
+*	cl_fmap_snap_t
+*
+* DESCRIPTION
+*	Immutable snapshot of a read mostly flexi map.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_fmap_snap
+{
+	cl_epoch_item_t			epoch_item;
+	size_t					count;
+	cl_fmap_item_t			*p_items[1];
+
+} cl_fmap_snap_t;
+/*
+* FIELDS
+*	epoch_item
+*		Used to retire the snapshot once it has been replaced.
+*
+*	count
+*		Number of items in the snapshot.
+*
+*	p_items
+*		Items of the map in key order.  The array is allocated to hold
+*		count entries.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_publish
+*********/
+
+
+/****s* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_t
+* NAME
+*	cl_rcu_fmap_t
+*
+* DESCRIPTION
+*	Read mostly flexi map structure.
+*
+*	The cl_rcu_fmap_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_rcu_fmap
+{
+	cl_fmap_t					map;
+	cl_fmap_snap_t* volatile	p_snap;
+	cl_epoch_t					*p_epoch;
+	boolean_t					dirty;
+	cl_state_t					state;
+
+} cl_rcu_fmap_t;
+/*
+* FIELDS
+*	map
+*		Flexi map updated by writers.
+*
+*	p_snap
+*		Snapshot currently published to readers.
+*
+*	p_epoch
+*		Epoch used by readers of the map and to retire snapshots.
+*
+*	dirty
+*		TRUE if the map was changed since the last publish.
+*
+*	state
+*		State of the map.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_construct
+* NAME
+*	cl_rcu_fmap_construct
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_construct function constructs a read mostly flexi map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_rcu_fmap_construct(
+	IN	cl_rcu_fmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_rcu_fmap_destroy without first calling
+*	cl_rcu_fmap_init.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_init, cl_rcu_fmap_destroy
+*********/
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_init
+* NAME
+*	cl_rcu_fmap_init
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_init function initializes a read mostly flexi map
+*	for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_rcu_fmap_init(
+	IN	cl_rcu_fmap_t* const	p_map,
+	IN	cl_pfn_fmap_cmp_t		pfn_compare,
+	IN	cl_epoch_t* const		p_epoch );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure to initialize.
+*
+*	pfn_compare
+*		[in] Pointer to the compare function used to compare keys.
+*		See the cl_pfn_fmap_cmp_t function type declaration for details
+*		about the callback function.
+*
+*	p_epoch
+*		[in] Pointer to an initialized epoch.  Several maps may share one
+*		epoch, so that each reading thread needs to register only once.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the map was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to allocate the
+*	initial, empty snapshot.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_destroy, cl_epoch_init
+*********/
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_destroy
+* NAME
+*	cl_rcu_fmap_destroy
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_destroy function destroys a read mostly flexi map.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_rcu_fmap_destroy(
+	IN	cl_rcu_fmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Readers must no longer access the map.  cl_rcu_fmap_destroy does not
+*	affect the items stored in the map.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_construct, cl_rcu_fmap_init
+*********/
+
+
+/****i* Component Library: Read Mostly Flexi Map/__cl_rcu_fmap_search
+* NAME
+*	__cl_rcu_fmap_search
+*
+* DESCRIPTION
+*	Binary search of a snapshot.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_fmap_item_t* CL_API
+__cl_rcu_fmap_search(
+	IN	const cl_fmap_snap_t* const	p_snap,
+	IN	const void* const			p_key,
+	IN	cl_pfn_fmap_cmp_t			pfn_compare )
+{
+	size_t	low = 0, high = p_snap->count, mid;
+	int		cmp;
+
+	while( low < high )
+	{
+		mid = low + ((high - low) >> 1);
+		cmp = pfn_compare( p_key, cl_fmap_key( p_snap->p_items[mid] ) );
+		if( !cmp )
+			return( p_snap->p_items[mid] );
+
+		if( cmp < 0 )
+			high = mid;
+		else
+			low = mid + 1;
+	}
+	return( NULL );
+}
+/*********/
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_get
+* NAME
+*	cl_rcu_fmap_get
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_get function returns the map item associated with a
+*	key, without taking any lock.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_fmap_item_t* CL_API
+cl_rcu_fmap_get(
+	IN	const cl_rcu_fmap_t* const	p_map,
+	IN	const void* const			p_key )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+
+	return( __cl_rcu_fmap_search(
+		p_map->p_snap, p_key, p_map->map.pfn_compare ) );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure from which to retrieve the
+*		item with the specified key.
+*
+*	p_key
+*		[in] Pointer to a key value used to search for the desired map item.
+*
+* RETURN VALUES
+*	Pointer to the map item with the desired key value.
+*
+*	NULL if there was no item with the desired key value in the last
+*	published snapshot.
+*
+* NOTES
+*	The caller must be inside a read side critical section of the map's
+*	epoch, and may use the returned item only until it calls
+*	cl_epoch_leave.
+*
+*	Changes made by writers are visible only once published.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_match, cl_epoch_enter, cl_fmap_get
+*********/
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_match
+* NAME
+*	cl_rcu_fmap_match
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_match function returns the map item matching a key
+*	using an alternate compare function, without taking any lock.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_fmap_item_t* CL_API
+cl_rcu_fmap_match(
+	IN	const cl_rcu_fmap_t* const	p_map,
+	IN	const void* const			p_key,
+	IN	cl_pfn_fmap_cmp_t			pfn_compare )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+
+	return( __cl_rcu_fmap_search( p_map->p_snap, p_key,
+		pfn_compare ? pfn_compare : p_map->map.pfn_compare ) );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure from which to retrieve the
+*		item matching the specified key.
+*
+*	p_key
+*		[in] Pointer to a key value used to search for the desired map item.
+*
+*	pfn_compare
+*		[in] Pointer to a compare function to invoke to compare the
+*		keys of items in the map.  The function must order items
+*		consistently with the map's own compare function.  Passing NULL
+*		makes the call equivalent to cl_rcu_fmap_get.
+*
+* RETURN VALUES
+*	Pointer to the map item matching the desired key value.
+*
+*	NULL if there was no matching item in the last published snapshot.
+*
+* NOTES
+*	The same read side rules as for cl_rcu_fmap_get apply.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_get, cl_fmap_match
+*********/
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_count
+* NAME
+*	cl_rcu_fmap_count
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_count function returns the number of items in the
+*	published snapshot of a read mostly flexi map.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_rcu_fmap_count(
+	IN	const cl_rcu_fmap_t* const	p_map )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+	return( p_map->p_snap->count );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure whose item count to return.
+*
+* RETURN VALUE
+*	Returns the number of items visible to readers.
+*
+* NOTES
+*	The caller must be inside a read side critical section of the map's
+*	epoch, or be the writer.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map
+*********/
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_insert
+* NAME
+*	cl_rcu_fmap_insert
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_insert function inserts a map item into a read mostly
+*	flexi map.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_fmap_item_t* CL_API
+cl_rcu_fmap_insert(
+	IN	cl_rcu_fmap_t* const	p_map,
+	IN	const void* const		p_key,
+	IN	cl_fmap_item_t* const	p_item )
+{
+	cl_fmap_item_t	*p_ret;
+
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+
+	p_ret = cl_fmap_insert( &p_map->map, p_key, p_item );
+	if( p_ret == p_item )
+		p_map->dirty = TRUE;
+	return( p_ret );
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure into which to add the item.
+*
+*	p_key
+*		[in] Pointer to the key value to assign to the item.  Storage for
+*		the key must be persistent, as only the pointer is stored.
+*
+*	p_item
+*		[in] Pointer to a cl_fmap_item_t stucture to insert into the map.
+*
+* RETURN VALUE
+*	Pointer to the item in the map with the specified key, as for
+*	cl_fmap_insert.
+*
+* NOTES
+*	The item becomes visible to readers at the next cl_rcu_fmap_publish.
+*	Must be called by the serialized writer.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_remove_item, cl_rcu_fmap_publish
+*********/
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_remove_item
+* NAME
+*	cl_rcu_fmap_remove_item
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_remove_item function removes an item from a read mostly
+*	flexi map.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_rcu_fmap_remove_item(
+	IN	cl_rcu_fmap_t* const	p_map,
+	IN	cl_fmap_item_t* const	p_item )
+{
+	CL_ASSERT( p_map );
+	CL_ASSERT( p_map->state == CL_INITIALIZED );
+
+	cl_fmap_remove_item( &p_map->map, p_item );
+	p_map->dirty = TRUE;
+}
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure from which to remove
+*		the item.
+*
+*	p_item
+*		[in] Pointer to the item to remove.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Readers keep finding the item until the next cl_rcu_fmap_publish, and
+*	may keep using it until the grace period that follows.  The item must
+*	not be freed or reused until then.  Either retire the containing object
+*	with cl_epoch_retire after publishing, or call cl_epoch_synchronize.
+*
+*	Must be called by the serialized writer.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_publish, cl_epoch_retire
+*********/
+
+
+/****f* Component Library: Read Mostly Flexi Map/cl_rcu_fmap_publish
+* NAME
+*	cl_rcu_fmap_publish
+*
+* DESCRIPTION
+*	The cl_rcu_fmap_publish function makes all changes to a read mostly
+*	flexi map visible to readers.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_rcu_fmap_publish(
+	IN	cl_rcu_fmap_t* const	p_map );
+/*
+* PARAMETERS
+*	p_map
+*		[in] Pointer to a cl_rcu_fmap_t structure to publish.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the changes were published, or if there was nothing
+*	to publish.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to allocate the
+*	new snapshot.  Readers keep seeing the previous snapshot, and the
+*	changes are published by the next successful call.
+*
+* NOTES
+*	The new snapshot is fully written before it is made visible, and the
+*	previous snapshot is retired to the map's epoch.
+*
+*	Must be called by the serialized writer.
+*
+* SEE ALSO
+*	Read Mostly Flexi Map, cl_rcu_fmap_insert, cl_rcu_fmap_remove_item
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#endif /* _CL_RCUFMAP_H_ */
@@ -67,16 +67,23 @@
 *	requests may be able to resume. It is recommended that users flush
 *	pending requests by calling cl_req_mgr_resume while CL_SUCCESS is returned.
 *
+*	cl_req_mgr_resume_batch resumes as many requests as available objects
+*	allow in a single call, querying the number of available objects once.
+*	Requests queued with cl_req_mgr_get_ex carry a priority, and partial
+*	requests are served in rounds so that one large requester does not
+*	starve others.  The request manager keeps counters of queue depth and
+*	wait time, returned by cl_req_mgr_get_stats.
+*
 *	The request manager functions operates on a cl_req_mgr_t structure which
 *	should be treated as opaque and should be manipulated only through the
 *	provided functions.
 *
 * SEE ALSO
 *	Types:
-*		cl_req_type_t
+*		cl_req_type_t, cl_req_priority_t
 *
 *	Structures:
-*		cl_req_mgr_t
+*		cl_req_mgr_t, cl_req_resume_t, cl_req_mgr_stats_t
 *
 *	Callbacks:
 *		cl_pfn_req_cb_t, cl_pfn_reqmgr_get_count_t
@@ -85,10 +92,11 @@
 *		cl_req_mgr_construct, cl_req_mgr_init, cl_req_mgr_destroy
 *
 *	Manipulation:
-*		cl_req_mgr_get, cl_req_mgr_resume
+*		cl_req_mgr_get, cl_req_mgr_get_ex, cl_req_mgr_resume,
+*		cl_req_mgr_resume_batch
 *
 *	Attributes:
-*		cl_is_req_mgr_inited, cl_req_mgr_count
+*		cl_is_req_mgr_inited, cl_req_mgr_count, cl_req_mgr_get_stats
 *********/
 
 
@@ -154,6 +162,129 @@ typedef enum _cl_req_type
 *********/
 
 
+/****d* Component Library: Request Manager/cl_req_priority_t
+* NAME
+*	cl_req_priority_t
+*
+* DESCRIPTION
+*	The cl_req_priority_t enumerated type describes the priority of an
+*	asynchronous request.
+*
+* SYNOPSIS
+*/
+typedef enum _cl_req_priority
+{
+	REQ_PRIORITY_HIGH,
+	REQ_PRIORITY_NORMAL,
+	REQ_PRIORITY_LOW,
+	REQ_PRIORITY_COUNT
+
+} cl_req_priority_t;
+/*
+* VALUES
+*	REQ_PRIORITY_HIGH
+*		Requests resumed before all others.
+*
+*	REQ_PRIORITY_NORMAL
+*		Priority of requests queued with cl_req_mgr_get.
+*
+*	REQ_PRIORITY_LOW
+*		Requests resumed only when no other request is pending.
+*
+*	REQ_PRIORITY_COUNT
+*		Number of priorities.  Not a valid priority.
+*
+* SEE ALSO
+*	Request Manager, cl_req_mgr_get_ex
+*********/
+
+
+/****s* Component Library: Request Manager/cl_req_resume_t
+* NAME
+*	cl_req_resume_t
+*
+* DESCRIPTION
+*	Information for resuming a request, returned by cl_req_mgr_resume_batch.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_req_resume
+{
+	cl_status_t			status;
+	size_t				count;
+	cl_pfn_req_cb_t		pfn_callback;
+	const void			*context1;
+	const void			*context2;
+
+} cl_req_resume_t;
+/*
+* FIELDS
+*	status
+*		CL_SUCCESS if the request was completed, or CL_PENDING if it was
+*		continued but remains queued for the rest of its objects.
+*
+*	count
+*		Number of objects available for the resuming request.
+*
+*	pfn_callback
+*		The pfn_callback value provided when the request was made.
+*
+*	context1
+*		The context1 value provided when the request was made.
+*
+*	context2
+*		The context2 value provided when the request was made.
+*
+* SEE ALSO
+*	Request Manager, cl_req_mgr_resume_batch
+*********/
+
+
+/****s* Component Library: Request Manager/cl_req_mgr_stats_t
+* NAME
+*	cl_req_mgr_stats_t
+*
+* DESCRIPTION
+*	Counters kept by a request manager.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_req_mgr_stats
+{
+	size_t				queue_depth[REQ_PRIORITY_COUNT];
+	size_t				max_queue_depth;
+	uint64_t			queued_count;
+	uint64_t			resumed_count;
+	uint64_t			total_wait_us;
+	uint64_t			max_wait_us;
+
+} cl_req_mgr_stats_t;
+/*
+* FIELDS
+*	queue_depth
+*		Number of requests currently queued at each priority.
+*
+*	max_queue_depth
+*		Largest total number of requests queued at once.
+*
+*	queued_count
+*		Number of asynchronous requests queued.
+*
+*	resumed_count
+*		Number of queued requests completed.
+*
+*	total_wait_us
+*		Sum of the times, in microseconds, completed requests spent queued.
+*		Dividing by resumed_count gives the average wait time.
+*
+*	max_wait_us
+*		Longest time, in microseconds, a completed request spent queued.
+*
+* SEE ALSO
+*	Request Manager, cl_req_mgr_get_stats
+*********/
+
+
 /****d* Component Library: Request Manager/cl_pfn_reqmgr_get_count_t
 * NAME
 *	cl_pfn_reqmgr_get_count_t
@@ -206,6 +337,9 @@ typedef struct _cl_req_mgr
 	const void					*get_context;
 	cl_qlist_t					request_queue;
 	cl_qpool_t					request_pool;
+	cl_qlist_t					high_queue;
+	cl_qlist_t					low_queue;
+	cl_req_mgr_stats_t			stats;
 
 } cl_req_mgr_t;
 /*
@@ -222,6 +356,18 @@ typedef struct _cl_req_mgr
 *	request_pool
 *		Pool of request structures for storing requests in the request queue.
 *
+*	high_queue
+*		Pending requests of priority REQ_PRIORITY_HIGH.
+*
+*	low_queue
+*		Pending requests of priority REQ_PRIORITY_LOW.
+*
+*	stats
+*		Counters of queue depth and wait time.
+*
+* NOTES
+*	request_queue holds the requests of priority REQ_PRIORITY_NORMAL.
+*
 * SEE ALSO
 *	Request Manager
 *********/
@@ -403,9 +549,14 @@ cl_req_mgr_get(
 *	Upon successful completion of this function, the p_count parameter contains
 *	the number of objects available.
 *
-*	Synchronous requests fail if there are any asynchronous requests pending,
-*	or if there are not enough resources to immediately satisfy the request in
-*	its entirety .
+*	cl_req_mgr_get queues requests with a priority of REQ_PRIORITY_NORMAL
+*	and follows the priority rule of cl_req_mgr_get_ex.  Synchronous requests
+*	fail if there are any asynchronous requests of priority REQ_PRIORITY_NORMAL
+*	or REQ_PRIORITY_HIGH pending, or if there are not enough resources to
+*	immediately satisfy the request in its entirety.  Pending requests of
+*	priority REQ_PRIORITY_LOW do not cause synchronous requests to fail.  When
+*	only cl_req_mgr_get is used, all requests have the same priority and the
+*	behavior is unchanged.
 *
 *	Asynchronous requests fail if there is insufficient system memory to
 *	queue them.
@@ -414,7 +565,7 @@ cl_req_mgr_get(
 *	information for resuming queued requests.
 *
 * SEE ALSO
-*	Request Manager, cl_req_mgr_resume
+*	Request Manager, cl_req_mgr_resume, cl_req_mgr_get_ex
 *********/
 
 
@@ -468,8 +619,155 @@ cl_req_mgr_resume(
 *	cl_req_mgr_resume resumes at most one request. Further requests may be
 *	able to be resumed if this call returns CL_SUCCESS.
 *
+*	The request resumed is the first of the highest priority queue that is
+*	not empty.  Use cl_req_mgr_resume_batch to resume several requests at
+*	once.
+*
 * SEE ALSO
-*	Request Manager, cl_req_mgr_get
+*	Request Manager, cl_req_mgr_get, cl_req_mgr_resume_batch
+*********/
+
+
+/****f* Component Library: Request Manager/cl_req_mgr_get_ex
+* NAME
+*	cl_req_mgr_get_ex
+*
+* DESCRIPTION
+*	The cl_req_mgr_get_ex function handles synchronous and asynchronous
+*	requests for objects, queuing asynchronous requests with a priority.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_req_mgr_get_ex(
+	IN		cl_req_mgr_t* const			p_req_mgr,
+	IN OUT	size_t* const				p_count,
+	IN		const cl_req_type_t			req_type,
+	IN		const cl_req_priority_t		priority,
+	IN		cl_pfn_req_cb_t				pfn_callback,
+	IN		const void* const			context1,
+	IN		const void* const			context2 );
+/*
+* PARAMETERS
+*	priority
+*		[in] Priority of the request if it is queued.
+*
+*	Other parameters are the same as those of cl_req_mgr_get.
+*
+* RETURN VALUES
+*	Same as cl_req_mgr_get.
+*
+* NOTES
+*	cl_req_mgr_get is equivalent to cl_req_mgr_get_ex with a priority of
+*	REQ_PRIORITY_NORMAL.
+*
+*	Synchronous requests and asynchronous requests that can be satisfied
+*	immediately are only granted if no request of the same or higher
+*	priority is pending, so that they do not overtake queued requests.
+*
+* SEE ALSO
+*	Request Manager, cl_req_mgr_get, cl_req_priority_t,
+*	cl_req_mgr_resume_batch
+*********/
+
+
+/****f* Component Library: Request Manager/cl_req_mgr_resume_batch
+* NAME
+*	cl_req_mgr_resume_batch
+*
+* DESCRIPTION
+*	The cl_req_mgr_resume_batch function resumes as many queued requests as
+*	available objects allow.
+*
+* SYNOPSIS
+*/
+CL_EXPORT size_t CL_API
+cl_req_mgr_resume_batch(
+	IN	cl_req_mgr_t* const		p_req_mgr,
+	IN	const size_t			partial_quantum,
+	OUT	cl_req_resume_t* const	p_resume_array,
+	IN	const size_t			array_size );
+/*
+* PARAMETERS
+*	p_req_mgr
+*		[in] Pointer to a cl_req_mgr_t structure from which to resume requests.
+*
+*	partial_quantum
+*		[in] Largest number of objects given to a REQ_GET_PARTIAL_OK request
+*		in one round.  Zero places no limit.
+*
+*	p_resume_array
+*		[out] Array receiving one entry per resumed request.
+*
+*	array_size
+*		[in] Number of entries in p_resume_array.
+*
+* RETURN VALUE
+*	Number of entries stored in p_resume_array.  Zero if no request could be
+*	resumed.
+*
+* NOTES
+*	The number of available objects is queried once through the
+*	pfn_get_count callback and decremented as requests are resumed.
+*	Callers must retrieve the objects for all returned entries before
+*	resuming requests again.
+*
+*	Queues are served from the highest priority.  Within a queue, requests
+*	are served in order.  A request that can not be satisfied stops the
+*	batch, since lower priority requests and later requests may not
+*	overtake it.
+*
+*	A REQ_GET_PARTIAL_OK request receiving partial_quantum objects without
+*	completing moves to the tail of its queue, letting the requests behind
+*	it be served in the next round.  The request appears with a status of
+*	CL_PENDING in the array.  A batch serves each request at most once.
+*
+*	Returning array_size entries means more requests may be resumed.
+*
+* SEE ALSO
+*	Request Manager, cl_req_mgr_resume, cl_req_resume_t, cl_req_mgr_get_ex
+*********/
+
+
+/****f* Component Library: Request Manager/cl_req_mgr_get_stats
+* NAME
+*	cl_req_mgr_get_stats
+*
+* DESCRIPTION
+*	The cl_req_mgr_get_stats function returns the counters of a request
+*	manager.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_req_mgr_get_stats(
+	IN	cl_req_mgr_t* const			p_req_mgr,
+	OUT	cl_req_mgr_stats_t* const	p_stats,
+	IN	const boolean_t				reset );
+/*
+* PARAMETERS
+*	p_req_mgr
+*		[in] Pointer to a cl_req_mgr_t structure.
+*
+*	p_stats
+*		[out] Receives the counters.
+*
+*	reset
+*		[in] TRUE to reset all counters except the current queue depths
+*		after copying them.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Wait times are measured with cl_get_time_stamp from the time a request
+*	is queued to the time it completes.
+*
+*	The request manager is not thread safe, and callers must serialize this
+*	function with other request manager functions.
+*
+* SEE ALSO
+*	Request Manager, cl_req_mgr_stats_t
 *********/
 
 
@@ -0,0 +1,482 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of the scalable reader/writer lock.  Readers acquire the
+ *	lock by updating a per-processor counter, and writers are preferred.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_RWLOCK_H_
+#define _CL_RWLOCK_H_
+
+
+#include <complib/cl_event.h>
+#include <complib/cl_atomic.h>
+#include <complib/cl_thread.h>
+
+
+/****h* Component Library/Reader Writer Lock
+* NAME
+*	Reader Writer Lock
+*
+* DESCRIPTION
+*	The Reader Writer Lock provides synchronization between multiple
+*	threads sharing the lock and a single thread holding it exclusively.
+*	It offers the same functions as the Passive Lock and can replace it,
+*	for data that is read far more often than written.
+*
+*	Each processor has its own reader counter, on its own cache line.  A
+*	reader increments the counter of the processor it runs on and checks
+*	that no writer is present, so readers neither wait on events nor write
+*	shared cache lines.  A reader may release the lock on another processor
+*	than the one it acquired it on; only the sum of all counters is
+*	meaningful.
+*
+*	A writer first announces itself, which makes new readers back off and
+*	wait, then waits for the sum of the reader counters to drop to zero.
+*	Writers are therefore never starved by a continuous flow of readers.
+*	Writers are serialized among themselves.
+*
+*	The lock works between threads and cannot be used in situations where
+*	the caller cannot be put into a waiting state.  It is not recursive.
+*
+*	The reader writer lock functions operate on a cl_rwlock_t structure
+*	which should be treated as opaque and should be manipulated only through
+*	the provided functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_rwlock_t
+*
+*	Initialization:
+*		cl_rwlock_construct, cl_rwlock_init, cl_rwlock_destroy
+*
+*	Manipulation
+*		cl_rwlock_acquire, cl_rwlock_excl_acquire, cl_rwlock_release
+*
+*	Related:
+*		Passive Lock
+*********/
+
+
+/****i* Component Library: Reader Writer Lock/cl_rw_slot_t
+* NAME
+*	cl_rw_slot_t
+*
+* DESCRIPTION
+*	Reader counter of one processor.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_rw_slot
+{
+	atomic32_t		readers;
+	uint8_t			pad[CL_CACHE_LINE_SIZE - sizeof(atomic32_t)];
+
+} cl_rw_slot_t;
+/*
+* FIELDS
+*	readers
+*		Number of readers that acquired the lock on the processor, minus
+*		the number that released it on the processor.  May be negative.
+*
+*	pad
+*		Pads the structure to a full cache line.
+*
+* SEE ALSO
+*	Reader Writer Lock
+*********/
+
+
+/****s* Component Library: Reader Writer Lock/cl_rwlock_t
+* NAME
+*	cl_rwlock_t
+*
+* DESCRIPTION
+*	Reader Writer Lock structure.
+*
+*	The cl_rwlock_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_rwlock
+{
+	atomic32_t		writer;
+	boolean_t		excl;
+	uint8_t			pad[CL_CACHE_LINE_SIZE - sizeof(atomic32_t) -
+						sizeof(boolean_t)];
+	cl_rw_slot_t	*p_slots;
+	uint32_t		slot_mask;
+	cl_event_t		reader_event;
+	cl_event_t		writer_event;
+	cl_event_t		excl_event;
+	cl_state_t		state;
+
+} cl_rwlock_t;
+/*
+* FIELDS
+*	writer
+*		Non-zero while a writer holds the lock or waits for readers to
+*		release it.
+*
+*	excl
+*		TRUE while a writer holds the lock.
+*
+*	pad
+*		Keeps the fields read by every reader on a cache line of their own.
+*
+*	p_slots
+*		Array of reader counters, one per processor rounded up to a power
+*		of two.
+*
+*	slot_mask
+*		Number of reader counters minus one.
+*
+*	reader_event
+*		Notification event, signalled when no writer is present, on which
+*		readers wait.
+*
+*	writer_event
+*		Event signalled by readers releasing the lock while a writer waits.
+*
+*	excl_event
+*		Event serializing writers.
+*
+*	state
+*		State of the lock.
+*
+* SEE ALSO
+*	Reader Writer Lock
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Reader Writer Lock/cl_rwlock_construct
+* NAME
+*	cl_rwlock_construct
+*
+* DESCRIPTION
+*	The cl_rwlock_construct function initializes the state of a
+*	reader writer lock.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_rwlock_construct(
+	IN	cl_rwlock_t* const	p_lock );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_rwlock_t structure whose state to initialize.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_rwlock_destroy without first calling cl_rwlock_init.
+*
+*	Calling cl_rwlock_construct is a prerequisite to calling any other
+*	reader writer lock function except cl_rwlock_init.
+*
+* SEE ALSO
+*	Reader Writer Lock, cl_rwlock_init, cl_rwlock_destroy
+*********/
+
+
+/****f* Component Library: Reader Writer Lock/cl_rwlock_init
+* NAME
+*	cl_rwlock_init
+*
+* DESCRIPTION
+*	The cl_rwlock_init function initializes a reader writer lock.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_rwlock_init(
+	IN	cl_rwlock_t* const	p_lock );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_rwlock_t structure to initialize.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the lock was initialized successfully.
+*
+*	CL_INSUFFICIENT_MEMORY if there was not enough memory to allocate the
+*	reader counters.
+*
+*	CL_ERROR if the events could not be initialized.
+*
+* NOTES
+*	Allows calling cl_rwlock_acquire, cl_rwlock_excl_acquire and
+*	cl_rwlock_release.
+*
+*	The reader counters are allocated according to cl_proc_count, and take
+*	one cache line per processor.
+*
+* SEE ALSO
+*	Reader Writer Lock, cl_rwlock_construct, cl_rwlock_destroy
+*********/
+
+
+/****f* Component Library: Reader Writer Lock/cl_rwlock_destroy
+* NAME
+*	cl_rwlock_destroy
+*
+* DESCRIPTION
+*	The cl_rwlock_destroy function performs any necessary cleanup
+*	of a reader writer lock.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_rwlock_destroy(
+	IN	cl_rwlock_t* const	p_lock );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_rwlock_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	This function must only be called if cl_rwlock_construct or
+*	cl_rwlock_init has been called.  The lock must not be held when calling
+*	this function.
+*
+* SEE ALSO
+*	Reader Writer Lock, cl_rwlock_construct, cl_rwlock_init
+*********/
+
+
+/****i* Component Library: Reader Writer Lock/__cl_rwlock_wait_writer
+* NAME
+*	__cl_rwlock_wait_writer
+*
+* DESCRIPTION
+*	The __cl_rwlock_wait_writer function waits until no writer is present.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+__cl_rwlock_wait_writer(
+	IN	cl_rwlock_t* const	p_lock );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_rwlock_t structure.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Slow path of cl_rwlock_acquire, called after the reader has backed out.
+*
+* SEE ALSO
+*	Reader Writer Lock, cl_rwlock_acquire
+*********/
+
+
+/****i* Component Library: Reader Writer Lock/__cl_rwlock_excl_release
+* NAME
+*	__cl_rwlock_excl_release
+*
+* DESCRIPTION
+*	The __cl_rwlock_excl_release function releases a reader writer lock
+*	held exclusively.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+__cl_rwlock_excl_release(
+	IN	cl_rwlock_t* const	p_lock );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_rwlock_t structure.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* SEE ALSO
+*	Reader Writer Lock, cl_rwlock_release
+*********/
+
+
+/****f* Component Library: Reader Writer Lock/cl_rwlock_acquire
+* NAME
+*	cl_rwlock_acquire
+*
+* DESCRIPTION
+*	The cl_rwlock_acquire function acquires a reader writer lock for
+*	shared access.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_rwlock_acquire(
+	IN	cl_rwlock_t* const	p_lock )
+{
+	cl_rw_slot_t	*p_slot;
+
+	CL_ASSERT( p_lock );
+	CL_ASSERT( p_lock->state == CL_INITIALIZED );
+
+	for( ;; )
+	{
+		p_slot = &p_lock->p_slots[cl_proc_current() & p_lock->slot_mask];
+
+		/*
+			The interlocked increment orders the check of the writer flag
+			after it, so either the writer sees this reader or this reader
+			sees the writer.
+		*/
+		cl_atomic_inc( &p_slot->readers );
+		if( !p_lock->writer )
+			return;
+
+		/* A writer is present.  Back out and wait for it. */
+		cl_atomic_dec( &p_slot->readers );
+		cl_event_signal( &p_lock->writer_event );
+		__cl_rwlock_wait_writer( p_lock );
+	}
+}
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_rwlock_t structure to acquire.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	When no writer is present, acquiring the lock costs one interlocked
+*	operation on a cache line private to the processor, and never waits.
+*
+* SEE ALSO
+*	Reader Writer Lock, cl_rwlock_release, cl_rwlock_excl_acquire
+*********/
+
+
+/****f* Component Library: Reader Writer Lock/cl_rwlock_excl_acquire
+* NAME
+*	cl_rwlock_excl_acquire
+*
+* DESCRIPTION
+*	The cl_rwlock_excl_acquire function acquires exclusive access
+*	to a reader writer lock.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_rwlock_excl_acquire(
+	IN	cl_rwlock_t* const	p_lock );
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_rwlock_t structure to acquire exclusively.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	New readers wait as soon as the writer starts waiting for current
+*	readers to release the lock.  The cost of acquiring the lock
+*	exclusively grows with the number of processors, since the writer sums
+*	all reader counters.
+*
+* SEE ALSO
+*	Reader Writer Lock, cl_rwlock_release, cl_rwlock_acquire
+*********/
+
+
+/****f* Component Library: Reader Writer Lock/cl_rwlock_release
+* NAME
+*	cl_rwlock_release
+*
+* DESCRIPTION
+*	The cl_rwlock_release function releases a reader writer lock from
+*	shared or exclusive access.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_rwlock_release(
+	IN	cl_rwlock_t* const	p_lock )
+{
+	CL_ASSERT( p_lock );
+	CL_ASSERT( p_lock->state == CL_INITIALIZED );
+
+	if( p_lock->excl )
+	{
+		__cl_rwlock_excl_release( p_lock );
+		return;
+	}
+
+	cl_atomic_dec(
+		&p_lock->p_slots[cl_proc_current() & p_lock->slot_mask].readers );
+
+	/* Let a waiting writer check whether all readers are gone. */
+	if( p_lock->writer )
+		cl_event_signal( &p_lock->writer_event );
+}
+/*
+* PARAMETERS
+*	p_lock
+*		[in] Pointer to a cl_rwlock_t structure to release.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Like cl_plock_release, the same function releases shared and exclusive
+*	access.
+*
+* SEE ALSO
+*	Reader Writer Lock, cl_rwlock_acquire, cl_rwlock_excl_acquire
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#endif	/* _CL_RWLOCK_H_ */
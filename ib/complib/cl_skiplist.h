@@ -0,0 +1,723 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of the concurrent skip list, a lock-free ordered map.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_SKIPLIST_H_
+#define _CL_SKIPLIST_H_
+
+
+#include <complib/cl_fleximap.h>
+#include <complib/cl_epoch.h>
+
+
+/****h* Component Library/Skip List
+* NAME
+*	Skip List
+*
+* DESCRIPTION
+*	The skip list is an ordered map of intrusive items that multiple
+*	threads may insert into, remove from and search concurrently, without
+*	any lock.  It suits ordered tables that are written as often as they
+*	are read, such as timer queues and transaction tables keyed by TID.
+*
+*	Items are kept in a sorted linked list, with each item also linked
+*	into a random number of sparser express lists.  Searches descend from
+*	the sparsest list, so insertion, removal and search take O(log n)
+*	expected time.  Links are updated with compare and exchange.  An item
+*	is removed by first marking its links, which stops concurrent
+*	insertions after it, then unlinking it.
+*
+*	Keys are either 64-bit unsigned integers, compared by value, or
+*	arbitrary keys compared with a cl_pfn_fmap_cmp_t function as in the
+*	flexi map.
+*
+*	Every thread accessing a skip list must do so from within a read side
+*	critical section of the list's epoch.  A removed item may still be
+*	referenced by other threads until a grace period has passed, and must
+*	be retired to the epoch or reused only after cl_epoch_synchronize.
+*
+*	The skip list functions operate on a cl_skiplist_t structure which
+*	should be treated as opaque and should be manipulated only through the
+*	provided functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_skiplist_t, cl_skiplist_item_t
+*
+*	Initialization:
+*		cl_skiplist_construct, cl_skiplist_init, cl_skiplist_destroy
+*
+*	Manipulation:
+*		cl_skiplist_insert, cl_skiplist_remove, cl_skiplist_remove_item
+*
+*	Search:
+*		cl_skiplist_get, cl_skiplist_lower_bound
+*
+*	Iteration:
+*		cl_skiplist_head, cl_skiplist_next, cl_skiplist_key
+*
+*	Attributes:
+*		cl_skiplist_count, cl_is_skiplist_empty
+*
+*	Related:
+*		Flexi Map, Epoch
+*********/
+
+
+/****d* Component Library: Skip List/CL_SKIPLIST_MAX_LEVEL
+* NAME
+*	CL_SKIPLIST_MAX_LEVEL
+*
+* DESCRIPTION
+*	Number of lists an item may be linked into.
+*
+* SYNOPSIS
+*/
+#define CL_SKIPLIST_MAX_LEVEL		12
+/*
+* NOTES
+*	An item is linked into one more list with a probability of 1/4, so 12
+*	levels keep searches logarithmic up to about 16 million items.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_item_t
+*********/
+
+
+/****s* Component Library: Skip List/cl_skiplist_item_t
+* NAME
+*	cl_skiplist_item_t
+*
+* DESCRIPTION
+*	The cl_skiplist_item_t structure is used by skip lists to store objects.
+*
+*	The cl_skiplist_item_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_skiplist_item
+{
+	struct _cl_skiplist_item* volatile	p_next[CL_SKIPLIST_MAX_LEVEL];
+	uint64_t							key;
+	const void							*p_key;
+	uint32_t							level;
+	cl_epoch_item_t						epoch_item;
+
+} cl_skiplist_item_t;
+/*
+* FIELDS
+*	p_next
+*		Next item in each list the item is linked into.  The lowest bit of
+*		a pointer is set once the item is being removed.
+*
+*	key
+*		Key of an item in a skip list with integer keys.
+*
+*	p_key
+*		Key of an item in a skip list with a compare function.
+*
+*	level
+*		Number of lists the item is linked into.
+*
+*	epoch_item
+*		Available to retire the item once it has been removed.
+*
+* NOTES
+*	Users embed a cl_skiplist_item_t in their objects, and use
+*	PARENT_STRUCT to get back to the object.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_insert, cl_epoch_retire
+*********/
+
+
+/****s* Component Library: Skip List/cl_skiplist_t
+* NAME
+*	cl_skiplist_t
+*
+* DESCRIPTION
+*	Skip list structure.
+*
+*	The cl_skiplist_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_skiplist
+{
+	cl_skiplist_item_t		head;
+	cl_pfn_fmap_cmp_t		pfn_compare;
+	cl_epoch_t				*p_epoch;
+	atomic32_t				level;
+	atomic32_t				count;
+	cl_state_t				state;
+
+} cl_skiplist_t;
+/*
+* FIELDS
+*	head
+*		Sentinel preceding the first item in every list.
+*
+*	pfn_compare
+*		Function used to compare keys, or NULL for integer keys.
+*
+*	p_epoch
+*		Epoch used by threads accessing the list.
+*
+*	level
+*		Number of lists currently in use, used to start searches.
+*
+*	count
+*		Number of items in the list.
+*
+*	state
+*		State of the list.
+*
+* SEE ALSO
+*	Skip List
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****i* Component Library: Skip List/__cl_skiplist_unmark
+* NAME
+*	__cl_skiplist_unmark
+*
+* DESCRIPTION
+*	Returns a link without its removal mark.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_skiplist_item_t* CL_API
+__cl_skiplist_unmark(
+	IN	cl_skiplist_item_t* const	p_link )
+{
+	return( (cl_skiplist_item_t*)((uintn_t)p_link & ~(uintn_t)1) );
+}
+/*
+* SEE ALSO
+*	Skip List, cl_skiplist_item_t
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_construct
+* NAME
+*	cl_skiplist_construct
+*
+* DESCRIPTION
+*	The cl_skiplist_construct function constructs a skip list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_skiplist_construct(
+	IN	cl_skiplist_t* const	p_list );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_skiplist_destroy without first calling
+*	cl_skiplist_init.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_init, cl_skiplist_destroy
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_init
+* NAME
+*	cl_skiplist_init
+*
+* DESCRIPTION
+*	The cl_skiplist_init function initializes a skip list for use.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_skiplist_init(
+	IN	cl_skiplist_t* const	p_list,
+	IN	cl_pfn_fmap_cmp_t		pfn_compare OPTIONAL,
+	IN	cl_epoch_t* const		p_epoch );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure to initialize.
+*
+*	pfn_compare
+*		[in] Pointer to the compare function used to compare keys.  If NULL,
+*		keys are 64-bit unsigned integers compared by value.
+*
+*	p_epoch
+*		[in] Pointer to an initialized epoch.  Several skip lists and read
+*		mostly flexi maps may share one epoch.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the skip list was initialized successfully.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_destroy, cl_epoch_init
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_destroy
+* NAME
+*	cl_skiplist_destroy
+*
+* DESCRIPTION
+*	The cl_skiplist_destroy function destroys a skip list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_skiplist_destroy(
+	IN	cl_skiplist_t* const	p_list );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Items still in the list are not freed, since they belong to the
+*	caller.  No other thread may access the list while it is destroyed.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_construct, cl_skiplist_init
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_insert
+* NAME
+*	cl_skiplist_insert
+*
+* DESCRIPTION
+*	The cl_skiplist_insert function inserts an item into a skip list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_skiplist_item_t* CL_API
+cl_skiplist_insert(
+	IN	cl_skiplist_t* const		p_list,
+	IN	const void* const			p_key,
+	IN	cl_skiplist_item_t* const	p_item );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure into which to insert.
+*
+*	p_key
+*		[in] Pointer to the key of the item.  For integer keys, points to a
+*		uint64_t that is copied into the item.  Otherwise, the pointer is
+*		stored and must remain valid while the item is in the list.
+*
+*	p_item
+*		[in] Pointer to a cl_skiplist_item_t structure to insert.
+*
+* RETURN VALUES
+*	Pointer to the item inserted.
+*
+*	Pointer to the item already in the list with the same key, in which
+*	case p_item is not inserted.
+*
+* NOTES
+*	The caller must be inside a read side critical section of the list's
+*	epoch.
+*
+*	The number of lists the item is linked into is derived from a hash of
+*	the item's address, so insertions share no random number state.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_remove, cl_skiplist_remove_item, cl_epoch_enter
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_remove_item
+* NAME
+*	cl_skiplist_remove_item
+*
+* DESCRIPTION
+*	The cl_skiplist_remove_item function removes an item from a skip list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT boolean_t CL_API
+cl_skiplist_remove_item(
+	IN	cl_skiplist_t* const		p_list,
+	IN	cl_skiplist_item_t* const	p_item );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure from which to remove.
+*
+*	p_item
+*		[in] Pointer to an item in the list.
+*
+* RETURN VALUES
+*	TRUE if this call removed the item.
+*
+*	FALSE if another thread removed it first.
+*
+* NOTES
+*	The caller must be inside a read side critical section of the list's
+*	epoch.
+*
+*	Only the thread for which the function returns TRUE owns the removed
+*	item.  Other threads may still reference the item, so the owner must
+*	retire it with cl_epoch_retire, using its epoch_item, or wait with
+*	cl_epoch_synchronize, outside of any critical section, before reusing
+*	it.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_remove, cl_skiplist_insert, cl_epoch_retire
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_remove
+* NAME
+*	cl_skiplist_remove
+*
+* DESCRIPTION
+*	The cl_skiplist_remove function removes the item with the specified key
+*	from a skip list.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_skiplist_item_t* CL_API
+cl_skiplist_remove(
+	IN	cl_skiplist_t* const	p_list,
+	IN	const void* const		p_key );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure from which to remove.
+*
+*	p_key
+*		[in] Pointer to the key of the item to remove.
+*
+* RETURN VALUES
+*	Pointer to the item removed, owned by the caller.
+*
+*	NULL if no item with the key was in the list.
+*
+* NOTES
+*	The same rules as for cl_skiplist_remove_item apply to the removed
+*	item.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_remove_item
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_get
+* NAME
+*	cl_skiplist_get
+*
+* DESCRIPTION
+*	The cl_skiplist_get function returns the item with the specified key.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_skiplist_item_t* CL_API
+cl_skiplist_get(
+	IN	const cl_skiplist_t* const	p_list,
+	IN	const void* const			p_key );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure to search.
+*
+*	p_key
+*		[in] Pointer to the key to search for.
+*
+* RETURN VALUES
+*	Pointer to the item with the key.
+*
+*	NULL if no item with the key is in the list.
+*
+* NOTES
+*	The caller must be inside a read side critical section of the list's
+*	epoch, and may use the item until it leaves the critical section even
+*	if another thread removes it.  Searches never write shared memory.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_lower_bound
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_lower_bound
+* NAME
+*	cl_skiplist_lower_bound
+*
+* DESCRIPTION
+*	The cl_skiplist_lower_bound function returns the first item whose key is
+*	greater than or equal to the specified key.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_skiplist_item_t* CL_API
+cl_skiplist_lower_bound(
+	IN	const cl_skiplist_t* const	p_list,
+	IN	const void* const			p_key );
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure to search.
+*
+*	p_key
+*		[in] Pointer to the key to search for.
+*
+* RETURN VALUES
+*	Pointer to the first item whose key is not less than p_key.
+*
+*	NULL if all keys are less than p_key.
+*
+* NOTES
+*	Combined with cl_skiplist_next, walks a range of keys, such as the
+*	timers expiring before a given time.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_get, cl_skiplist_next
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_next
+* NAME
+*	cl_skiplist_next
+*
+* DESCRIPTION
+*	The cl_skiplist_next function returns the item following an item in key
+*	order.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_skiplist_item_t* CL_API
+cl_skiplist_next(
+	IN	const cl_skiplist_item_t* const	p_item )
+{
+	cl_skiplist_item_t	*p_next;
+
+	CL_ASSERT( p_item );
+
+	/* Skip items that are being removed. */
+	p_next = __cl_skiplist_unmark( p_item->p_next[0] );
+	while( p_next && ((uintn_t)p_next->p_next[0] & 1) )
+		p_next = __cl_skiplist_unmark( p_next->p_next[0] );
+
+	return( p_next );
+}
+/*
+* PARAMETERS
+*	p_item
+*		[in] Pointer to an item in a skip list.
+*
+* RETURN VALUES
+*	Pointer to the next item in key order.
+*
+*	NULL if p_item is the last item.
+*
+* NOTES
+*	The caller must be inside a read side critical section of the list's
+*	epoch.  Iteration is weakly consistent: it returns every item present
+*	for the whole iteration, in key order, and may or may not return items
+*	inserted or removed during it.
+*
+*	p_item may have been removed since it was returned.  Iteration then
+*	continues from the item that followed it at the time of removal.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_head, cl_skiplist_key
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_head
+* NAME
+*	cl_skiplist_head
+*
+* DESCRIPTION
+*	The cl_skiplist_head function returns the item with the lowest key in a
+*	skip list.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_skiplist_item_t* CL_API
+cl_skiplist_head(
+	IN	const cl_skiplist_t* const	p_list )
+{
+	CL_ASSERT( p_list );
+	CL_ASSERT( p_list->state == CL_INITIALIZED );
+
+	return( cl_skiplist_next( &p_list->head ) );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure.
+*
+* RETURN VALUES
+*	Pointer to the item with the lowest key.
+*
+*	NULL if the list is empty.
+*
+* NOTES
+*	The item with the lowest key is the next timer to expire in a timer
+*	queue keyed by expiration time.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_next
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_key
+* NAME
+*	cl_skiplist_key
+*
+* DESCRIPTION
+*	The cl_skiplist_key function returns the integer key of an item.
+*
+* SYNOPSIS
+*/
+CL_INLINE uint64_t CL_API
+cl_skiplist_key(
+	IN	const cl_skiplist_item_t* const	p_item )
+{
+	CL_ASSERT( p_item );
+	return( p_item->key );
+}
+/*
+* PARAMETERS
+*	p_item
+*		[in] Pointer to an item in a skip list with integer keys.
+*
+* RETURN VALUE
+*	Key of the item.
+*
+* NOTES
+*	Items of skip lists with a compare function return their key through
+*	their p_key field, which the caller provided.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_insert
+*********/
+
+
+/****f* Component Library: Skip List/cl_skiplist_count
+* NAME
+*	cl_skiplist_count
+*
+* DESCRIPTION
+*	The cl_skiplist_count function returns the number of items in a skip
+*	list.
+*
+* SYNOPSIS
+*/
+CL_INLINE size_t CL_API
+cl_skiplist_count(
+	IN	const cl_skiplist_t* const	p_list )
+{
+	CL_ASSERT( p_list );
+	CL_ASSERT( p_list->state == CL_INITIALIZED );
+
+	return( (size_t)p_list->count );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure.
+*
+* RETURN VALUE
+*	Number of items in the list.
+*
+* NOTES
+*	The value may be outdated as soon as it is returned if other threads
+*	modify the list.
+*
+* SEE ALSO
+*	Skip List, cl_is_skiplist_empty
+*********/
+
+
+/****f* Component Library: Skip List/cl_is_skiplist_empty
+* NAME
+*	cl_is_skiplist_empty
+*
+* DESCRIPTION
+*	The cl_is_skiplist_empty function returns whether a skip list is empty.
+*
+* SYNOPSIS
+*/
+CL_INLINE boolean_t CL_API
+cl_is_skiplist_empty(
+	IN	const cl_skiplist_t* const	p_list )
+{
+	return( cl_skiplist_head( p_list ) == NULL );
+}
+/*
+* PARAMETERS
+*	p_list
+*		[in] Pointer to a cl_skiplist_t structure.
+*
+* RETURN VALUES
+*	TRUE if the list has no item.
+*
+*	FALSE otherwise.
+*
+* NOTES
+*	The caller must be inside a read side critical section of the list's
+*	epoch.
+*
+* SEE ALSO
+*	Skip List, cl_skiplist_count
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#endif	/* _CL_SKIPLIST_H_ */
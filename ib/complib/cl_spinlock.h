@@ -45,6 +45,9 @@
 
 
 #include <complib/cl_spinlock_osd.h>
+#ifdef CL_PROFILE_LOCKS
+#include <complib/cl_lockprof.h>
+#endif
 
 
 /****h* Component Library/Spinlock
@@ -64,10 +67,14 @@
 *		cl_spinlock_t
 *
 *	Initialization:
-*		cl_spinlock_construct, cl_spinlock_init, cl_spinlock_destroy
+*		cl_spinlock_construct, cl_spinlock_init, cl_spinlock_init_named,
+*		cl_spinlock_destroy
 *
 *	Manipulation
 *		cl_spinlock_acquire, cl_spinlock_release
+*
+*	Statistics (CL_FUTEX_LOCKS only)
+*		cl_spinlock_get_stats
 *********/
 
 
@@ -231,8 +238,150 @@ cl_spinlock_release(
 *********/
 
 
+#ifdef CL_FUTEX_LOCKS
+
+/****f* Component Library: Spinlock/cl_spinlock_get_stats
+* NAME
+*	cl_spinlock_get_stats
+*
+* DESCRIPTION
+*	The cl_spinlock_get_stats function returns the contention statistics
+*	of a spin lock.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_spinlock_get_stats(
+	IN	const cl_spinlock_t* const	p_spinlock,
+	OUT	cl_lock_stats_t* const		p_stats );
+/*
+* PARAMETERS
+*	p_spinlock
+*		[in] Pointer to a spin lock structure.
+*
+*	p_stats
+*		[out] Receives the number of contended acquisitions, how many of
+*		them were satisfied by spinning, and how many had to park.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Available only when CL_FUTEX_LOCKS is defined.  Waiters spin with
+*	exponential backoff before parking with WaitOnAddress.  The spin limit
+*	adapts to the lock: it grows when spinning succeeds and shrinks when
+*	waiters end up parking.
+*
+*	The counters are read without synchronization and are only updated on
+*	contended paths, so uncontended acquisitions cost nothing extra.
+*
+*	Futex locks are only available in user mode on Windows.  There is no
+*	futex backend for Linux, and cl_event_t always remains a kernel event
+*	handle, so that it can still be waited on through cl_waitobj.
+*
+* SEE ALSO
+*	Spinlock, cl_spinlock_acquire, cl_mutex_get_stats
+*********/
+
+#endif	/* CL_FUTEX_LOCKS */
+
+
+/****f* Component Library: Spinlock/cl_spinlock_init_named
+* NAME
+*	cl_spinlock_init_named
+*
+* DESCRIPTION
+*	The cl_spinlock_init_named function initializes a spin lock and names
+*	it for the lock profiler.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_status_t CL_API
+cl_spinlock_init_named(
+	IN	cl_spinlock_t* const	p_spinlock,
+	IN	const char* const		p_name )
+{
+	cl_status_t	status;
+
+	status = cl_spinlock_init( p_spinlock );
+#ifdef CL_PROFILE_LOCKS
+	if( status == CL_SUCCESS )
+		cl_lock_prof_register( p_spinlock, CL_LOCK_SPINLOCK, p_name );
+#else
+	UNUSED_PARAM( p_name );
+#endif
+	return( status );
+}
+/*
+* PARAMETERS
+*	p_spinlock
+*		[in] Pointer to a spin lock structure to initialize.
+*
+*	p_name
+*		[in] Name of the lock in profiler reports.  The string must remain
+*		valid while the lock is profiled.
+*
+* RETURN VALUES
+*	Same as cl_spinlock_init.
+*
+* NOTES
+*	The name is ignored unless CL_PROFILE_LOCKS is defined.
+*
+* SEE ALSO
+*	Spinlock, cl_spinlock_init, Lock Profiler
+*********/
+
+
 #ifdef __cplusplus
 }	/* extern "C" */
 #endif
 
+
+#ifdef CL_PROFILE_LOCKS
+
+CL_INLINE void CL_API
+__cl_spinlock_acquire_prof(
+	IN	cl_spinlock_t* const	p_spinlock,
+	IN	const cl_lock_type_t	type,
+	IN	const char* const		p_file_name,
+	IN	const int32_t			line_num )
+{
+	cl_lock_prof_t	*p_prof;
+	uint64_t		start_time;
+
+	p_prof = cl_lock_prof_get( p_spinlock, type );
+	start_time = cl_get_time_stamp();
+	(cl_spinlock_acquire)( p_spinlock );
+	__cl_lock_prof_acquired( p_prof, start_time, p_file_name, line_num );
+}
+
+
+CL_INLINE void CL_API
+__cl_spinlock_release_prof(
+	IN	cl_spinlock_t* const	p_spinlock,
+	IN	const cl_lock_type_t	type )
+{
+	__cl_lock_prof_releasing( cl_lock_prof_get( p_spinlock, type ) );
+	(cl_spinlock_release)( p_spinlock );
+}
+
+
+CL_INLINE void CL_API
+__cl_spinlock_destroy_prof(
+	IN	cl_spinlock_t* const	p_spinlock )
+{
+	cl_lock_prof_deregister( p_spinlock );
+	(cl_spinlock_destroy)( p_spinlock );
+}
+
+
+#define cl_spinlock_acquire( p_spinlock ) \
+	__cl_spinlock_acquire_prof( p_spinlock, CL_LOCK_SPINLOCK, __FILE__, __LINE__ )
+#define cl_spinlock_release( p_spinlock ) \
+	__cl_spinlock_release_prof( p_spinlock, CL_LOCK_SPINLOCK )
+#define cl_spinlock_destroy( p_spinlock ) \
+	__cl_spinlock_destroy_prof( p_spinlock )
+
+#endif	/* CL_PROFILE_LOCKS */
+
 #endif /* _CL_SPINLOCK_H_ */
@@ -334,6 +334,36 @@ cl_proc_count( void );
 *********/
 
 
+/****f* Component Library: Thread/cl_proc_current
+* NAME
+*	cl_proc_current
+*
+* DESCRIPTION
+*	The cl_proc_current function returns the number of the processor
+*	executing the calling thread.
+*
+* SYNOPSIS
+*/
+CL_EXPORT uint32_t CL_API
+cl_proc_current( void );
+/*
+* RETURN VALUE
+*	Returns the zero based number of the current processor.
+*
+* NOTES
+*	Unless the caller runs at an IRQL that prevents rescheduling, the thread
+*	may be moved to a different processor at any time, and the returned
+*	value is only a hint.  Users such as per-processor caches must tolerate
+*	two threads using the same processor number concurrently.
+*
+*	The returned value may exceed the value returned by cl_proc_count on
+*	systems where processors are added while running.
+*
+* SEE ALSO
+*	Thread, cl_proc_count
+*********/
+
+
 /****i* Component Library: Thread/cl_is_current_thread
 * NAME
 *	cl_is_current_thread
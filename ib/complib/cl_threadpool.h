@@ -47,6 +47,9 @@
 #include <complib/cl_list.h>
 #include <complib/cl_thread.h>
 #include <complib/cl_event.h>
+#include <complib/cl_spinlock.h>
+#include <complib/cl_timer.h>
+#include <complib/cl_wsdeque.h>
 
 
 /****h* Component Library/Thread Pool
@@ -60,19 +63,378 @@
 *	invoking a user specified callback function. All threads in the thread
 *	pool invoke the same callback function.
 *
+*	The threads of a thread pool also form a work-stealing executor.  Each
+*	thread is a worker owning a Chase-Lev deque of tasks.  Workers run the
+*	tasks of their own deque newest first, and steal the oldest tasks of
+*	other workers when they run out, so tasks spawned by a task usually
+*	run on the same processor while idle workers still balance the load.
+*	cl_thread_pool_signal and the callback are served by the same workers,
+*	so existing users of the thread pool run unchanged.
+*
 *	The thread pool functions operate on a cl_thread_pool_t structure which
 *	should be treated as opaque, and should be manipulated only through the
 *	provided functions.
 *
 * SEE ALSO
 *	Structures:
-*		cl_thread_pool_t
+*		cl_thread_pool_t, cl_thread_pool_task_t, cl_thread_pool_worker_t,
+*		cl_thread_pool_stats_t
+*
+*	Callbacks:
+*		cl_pfn_thread_pool_task_t
 *
 *	Initialization:
-*		cl_thread_pool_construct, cl_thread_pool_init, cl_thread_pool_destroy
+*		cl_thread_pool_construct, cl_thread_pool_init,
+*		cl_thread_pool_init_ex, cl_thread_pool_destroy
 *
 *	Manipulation
-*		cl_thread_pool_signal
+*		cl_thread_pool_signal, cl_qlist_parallel_apply,
+*		cl_thread_pool_submit, cl_thread_pool_spawn
+*
+*	Attributes:
+*		cl_thread_pool_get_stats
+*********/
+
+
+/****d* Component Library: Thread Pool/CL_THREAD_POOL_MAX_SLICES
+* NAME
+*	CL_THREAD_POOL_MAX_SLICES
+*
+* DESCRIPTION
+*	Maximum number of slices a list is cut into by cl_qlist_parallel_apply.
+*
+* SYNOPSIS
+*/
+#define CL_THREAD_POOL_MAX_SLICES		64
+/*
+* SEE ALSO
+*	Thread Pool, cl_qlist_parallel_apply, CL_THREAD_POOL_MIN_SLICE_ITEMS
+*********/
+
+
+/****d* Component Library: Thread Pool/CL_THREAD_POOL_MIN_SLICE_ITEMS
+* NAME
+*	CL_THREAD_POOL_MIN_SLICE_ITEMS
+*
+* DESCRIPTION
+*	Minimum number of list items handed to a thread by
+*	cl_qlist_parallel_apply.
+*
+* SYNOPSIS
+*/
+#define CL_THREAD_POOL_MIN_SLICE_ITEMS	32
+/*
+* NOTES
+*	Lists too short to give every slice this many items are cut into fewer
+*	slices.  Lists shorter than twice this value are processed entirely by
+*	the calling thread, since waking a thread costs more than the work.
+*
+* SEE ALSO
+*	Thread Pool, cl_qlist_parallel_apply, CL_THREAD_POOL_MAX_SLICES
+*********/
+
+
+/****d* Component Library: Thread Pool/CL_THREAD_POOL_ANY_WORKER
+* NAME
+*	CL_THREAD_POOL_ANY_WORKER
+*
+* DESCRIPTION
+*	Affinity hint letting the thread pool choose the worker that receives
+*	a submitted task.
+*
+* SYNOPSIS
+*/
+#define CL_THREAD_POOL_ANY_WORKER	0xFFFFFFFF
+/*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_submit
+*********/
+
+
+/****d* Component Library: Thread Pool/cl_thread_pool_pin_t
+* NAME
+*	cl_thread_pool_pin_t
+*
+* DESCRIPTION
+*	Processor pinning policy of the threads of a thread pool.
+*
+* SYNOPSIS
+*/
+typedef enum _cl_thread_pool_pin
+{
+	CL_THREAD_POOL_PIN_NONE,
+	CL_THREAD_POOL_PIN_PROC
+
+} cl_thread_pool_pin_t;
+/*
+* VALUES
+*	CL_THREAD_POOL_PIN_NONE
+*		Threads may run on any processor.
+*
+*	CL_THREAD_POOL_PIN_PROC
+*		Worker n only runs on processor n modulo the number of processors.
+*		Affinity hints then select a processor, and the data touched by
+*		tasks stays in that processor's cache.
+*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_init_ex, cl_thread_pool_submit
+*********/
+
+
+/* Declare the structures so the task callback can reference them. */
+struct _cl_thread_pool_task;
+struct _cl_thread_pool_worker;
+struct _cl_thread_pool;
+
+
+/****d* Component Library: Thread Pool/cl_pfn_thread_pool_task_t
+* NAME
+*	cl_pfn_thread_pool_task_t
+*
+* DESCRIPTION
+*	The cl_pfn_thread_pool_task_t function type defines the prototype for
+*	tasks run by the workers of a thread pool.
+*
+* SYNOPSIS
+*/
+typedef void
+(CL_API *cl_pfn_thread_pool_task_t)(
+	IN	struct _cl_thread_pool_task* const		p_task,
+	IN	struct _cl_thread_pool_worker* const	p_worker );
+/*
+* PARAMETERS
+*	p_task
+*		[in] Pointer to the task that was submitted or spawned.
+*
+*	p_worker
+*		[in] Worker running the task, which may be passed to
+*		cl_thread_pool_spawn to run more tasks.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The task is not referenced by the thread pool once its function is
+*	called, so the function may free or reuse it.
+*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_task_t, cl_thread_pool_spawn
+*********/
+
+
+/****s* Component Library: Thread Pool/cl_thread_pool_task_t
+* NAME
+*	cl_thread_pool_task_t
+*
+* DESCRIPTION
+*	Task run by the workers of a thread pool.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_thread_pool_task
+{
+	cl_list_item_t				list_item;
+	cl_pfn_thread_pool_task_t	pfn_task;
+	uint64_t					submit_time;
+
+} cl_thread_pool_task_t;
+/*
+* FIELDS
+*	list_item
+*		Used by the thread pool to queue tasks submitted by threads that
+*		are not workers.
+*
+*	pfn_task
+*		Function run by a worker.  Set by the user before submitting.
+*
+*	submit_time
+*		Time stamp of the submission, used for the queueing delay
+*		statistics.
+*
+* NOTES
+*	Tasks are embedded in user structures, which the task function finds
+*	with PARENT_STRUCT, so submitting a task does not allocate memory.
+*
+* SEE ALSO
+*	Thread Pool, cl_pfn_thread_pool_task_t, cl_thread_pool_submit
+*********/
+
+
+/****s* Component Library: Thread Pool/cl_thread_pool_worker_t
+* NAME
+*	cl_thread_pool_worker_t
+*
+* DESCRIPTION
+*	Worker of a thread pool, one per thread.
+*
+*	The cl_thread_pool_worker_t structure is internal to the thread pool
+*	and should not be manipulated by users.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_thread_pool_worker
+{
+	cl_ws_deque_t				deque;
+	cl_spinlock_t				inbox_lock;
+	cl_qlist_t					inbox;
+	struct _cl_thread_pool		*p_pool;
+	cl_thread_t					thread;
+	uint32_t					index;
+	uint32_t					steal_seed;
+	uint64_t					run_count;
+	uint64_t					steal_count;
+
+} cl_thread_pool_worker_t;
+/*
+* FIELDS
+*	deque
+*		Tasks spawned by the worker.  Only the worker pushes and pops, other
+*		workers steal.
+*
+*	inbox_lock
+*		Spinlock guarding the inbox.
+*
+*	inbox
+*		Tasks submitted to the worker by threads that are not workers of
+*		the pool.
+*
+*	p_pool
+*		Thread pool that owns the worker.
+*
+*	thread
+*		Thread running the worker.
+*
+*	index
+*		Index of the worker in the pool.
+*
+*	steal_seed
+*		State of the random generator choosing steal victims.
+*
+*	run_count
+*		Number of tasks run by the worker.
+*
+*	steal_count
+*		Number of tasks the worker stole from other workers.
+*
+* NOTES
+*	A worker looks for work in its deque, then its inbox, then pending
+*	signals, and finally steals from the deques and inboxes of randomly
+*	chosen workers.  It parks on the pool's wakeup event only once a full
+*	round of steal attempts finds nothing.
+*
+*	Workers are allocated on cache line boundaries, so that the deques of
+*	different workers do not share cache lines.
+*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_t, cl_ws_deque_t
+*********/
+
+
+/****s* Component Library: Thread Pool/cl_thread_pool_stats_t
+* NAME
+*	cl_thread_pool_stats_t
+*
+* DESCRIPTION
+*	Statistics of a thread pool.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_thread_pool_stats
+{
+	uint64_t		run_count;
+	uint64_t		steal_count;
+	uint64_t		park_count;
+	uint64_t		delay_total;
+	uint64_t		delay_max;
+
+} cl_thread_pool_stats_t;
+/*
+* FIELDS
+*	run_count
+*		Number of tasks run, including callbacks invoked for signals.
+*
+*	steal_count
+*		Number of tasks run by a worker other than the one that received
+*		them.
+*
+*	park_count
+*		Number of times a worker found no work and waited.
+*
+*	delay_total
+*		Total time, in microseconds, tasks spent queued before running.
+*
+*	delay_max
+*		Longest time, in microseconds, a task spent queued.
+*
+* NOTES
+*	delay_total divided by run_count gives the mean queueing delay, and
+*	delay_max bounds its tail.
+*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_get_stats
+*********/
+
+
+/****s* Component Library: Thread Pool/cl_thread_pool_job_t
+* NAME
+*	cl_thread_pool_job_t
+*
+* DESCRIPTION
+*	Parallel apply request shared by the calling thread and the threads of
+*	a thread pool.
+*
+*	The cl_thread_pool_job_t structure is internal to the thread pool and
+*	should not be manipulated by users.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_thread_pool_job
+{
+	cl_qlist_t				*p_slices;
+	uint32_t				slice_count;
+	atomic32_t				next_slice;
+	atomic32_t				busy_count;
+	atomic32_t				wake_count;
+	cl_pfn_qlist_apply_t	pfn_func;
+	const void				*context;
+	cl_event_t				done_event;
+
+} cl_thread_pool_job_t;
+/*
+* FIELDS
+*	p_slices
+*		Array of quick lists holding the slices of the list being processed.
+*
+*	slice_count
+*		Number of entries in the p_slices array.
+*
+*	next_slice
+*		Index of the next slice to claim.  Threads claim slices by
+*		atomically incrementing this value until it passes slice_count.
+*
+*	busy_count
+*		Number of pool threads currently working on the job.
+*
+*	wake_count
+*		Number of pool threads signalled for the job that have not yet
+*		claimed their wakeup.  A woken thread works on the job only if it
+*		can atomically decrement this value without taking it below zero.
+*
+*	pfn_func
+*		Function invoked for every list item.
+*
+*	context
+*		Value passed to pfn_func.
+*
+*	done_event
+*		Event signalled by the last pool thread to leave the job.
+*
+* NOTES
+*	The job lives on the stack of the thread calling
+*	cl_qlist_parallel_apply for the duration of the call.
+*
+* SEE ALSO
+*	Thread Pool, cl_qlist_parallel_apply
 *********/
 
 
@@ -98,8 +460,16 @@ typedef struct _cl_thread_pool
 	boolean_t					exit;
 	cl_state_t					state;
 	atomic32_t					running_count;
+	cl_thread_pool_job_t* volatile	p_job;
 	// for debug
 	cl_thread_t					*p_thread[8];
+	cl_thread_pool_worker_t		*p_workers;
+	uint32_t					worker_count;
+	cl_thread_pool_pin_t		pin;
+	atomic32_t					next_worker;
+	atomic32_t					idle_count;
+	atomic32_t					signal_pending;
+	cl_thread_pool_stats_t		stats;
 
 } cl_thread_pool_t;
 /*
@@ -128,6 +498,39 @@ typedef struct _cl_thread_pool
 *	running_count
 *		Number of threads running.
 *
+*	p_job
+*		Parallel apply request in progress, or NULL.  A thread woken while
+*		a job is posted works on it only if it claims one of the job's
+*		wakeups.  Otherwise it goes on as if no job were posted, and only
+*		invokes pfn_callback if signal_pending is set.
+*
+*	p_workers
+*		Array of workers, one per thread.
+*
+*	worker_count
+*		Number of entries in the p_workers array.
+*
+*	pin
+*		Processor pinning policy of the threads.
+*
+*	next_worker
+*		Worker receiving the next task submitted without an affinity hint,
+*		when threads are not pinned.
+*
+*	idle_count
+*		Number of workers parked on wakeup_event.  Submitting a task only
+*		signals the event when a worker is parked.  A worker increments
+*		the count with a full barrier and checks for work once more before
+*		parking.  cl_thread_pool_spawn reads the count with an interlocked
+*		add of zero after its push, so that the two full barriers pair.
+*
+*	signal_pending
+*		Set by cl_thread_pool_signal, and cleared by the worker that
+*		invokes pfn_callback for it.
+*
+*	stats
+*		Pool statistics, accumulated from the workers when they park.
+*
 * SEE ALSO
 *	Thread Pool
 *********/
@@ -293,11 +696,287 @@ cl_thread_pool_signal(
 *
 *	If all threads are running, cl_thread_pool_signal has no effect.
 *
+*	Signals are not consumed by a concurrent cl_qlist_parallel_apply.  The
+*	job accounts for the threads it signals in its own wake count, and a
+*	thread that claims none of the job's wakeups serves signal_pending as
+*	usual.  pfn_callback runs only when signal_pending is set, whichever
+*	event woke the thread.
+*
+*	Signals are served by the workers between tasks.  Signals sent before
+*	a worker picks up the previous one are coalesced with it.
+*
 * SEE ALSO
 *	Thread Pool
 *********/
 
 
+/****f* Component Library: Thread Pool/cl_qlist_parallel_apply
+* NAME
+*	cl_qlist_parallel_apply
+*
+* DESCRIPTION
+*	The cl_qlist_parallel_apply function executes a specified function for
+*	every list item stored in a quick list, using the threads of a thread
+*	pool alongside the calling thread.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_qlist_parallel_apply(
+	IN	cl_thread_pool_t* const	p_thread_pool,
+	IN	cl_qlist_t* const		p_list,
+	IN	cl_pfn_qlist_apply_t	pfn_func,
+	IN	const void* const		context );
+/*
+* PARAMETERS
+*	p_thread_pool
+*		[in] Pointer to an initialized thread pool whose threads share
+*		the work.
+*
+*	p_list
+*		[in] Pointer to a cl_qlist_t structure whose items to process.
+*
+*	pfn_func
+*		[in] Function invoked for every item in the quick list.
+*		See the cl_pfn_qlist_apply_t function type declaration for details
+*		about the callback function.
+*
+*	context
+*		[in] Value to pass to the callback functions to provide context.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The list is cut with cl_qlist_split_n into one slice per pool thread
+*	plus one for the calling thread, limited by CL_THREAD_POOL_MAX_SLICES
+*	and CL_THREAD_POOL_MIN_SLICE_ITEMS.  The job is posted to the thread
+*	pool with its wake count set to the number of extra slices, one thread
+*	is signalled per extra slice, and the calling thread then claims and
+*	processes slices itself.  Slices are claimed with an atomic increment,
+*	so the job completes even if no pool thread wakes up in time.  The
+*	function returns once every slice has been processed, after
+*	reassembling the list in its original order.
+*
+*	Items are visited concurrently and in no particular order.  pfn_func
+*	must be safe to call from several threads at once, and must not
+*	perform any list operations.  The list must not be accessed by other
+*	threads until the function returns.
+*
+*	Only one parallel apply may be in progress per thread pool.  A thread
+*	pool used only for parallel apply may be initialized with a callback
+*	that does nothing.
+*
+*	This function blocks, and must not be called from any of the thread
+*	pool's threads.
+*
+* SEE ALSO
+*	Thread Pool, cl_qlist_split_n, cl_qlist_apply_func,
+*	cl_thread_pool_signal, cl_pfn_qlist_apply_t
+*********/
+
+
+/****f* Component Library: Thread Pool/cl_thread_pool_init_ex
+* NAME
+*	cl_thread_pool_init_ex
+*
+* DESCRIPTION
+*	The cl_thread_pool_init_ex function creates the threads of a thread
+*	pool with a processor pinning policy.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_thread_pool_init_ex(
+	IN	cl_thread_pool_t* const		p_thread_pool,
+	IN	uint32_t					thread_count,
+	IN	cl_pfn_thread_callback_t	pfn_callback OPTIONAL,
+	IN	const void* const			context,
+	IN	const char* const			name,
+	IN	const cl_thread_pool_pin_t	pin );
+/*
+* PARAMETERS
+*	p_thread_pool, thread_count, context, name
+*		[in] Same as for cl_thread_pool_init.
+*
+*	pfn_callback
+*		[in] Function invoked by a thread for every cl_thread_pool_signal.
+*		May be NULL if the pool is only used to run tasks.
+*
+*	pin
+*		[in] Processor pinning policy of the threads.
+*
+* RETURN VALUES
+*	Same as for cl_thread_pool_init.
+*
+* NOTES
+*	cl_thread_pool_init is equivalent to cl_thread_pool_init_ex with
+*	CL_THREAD_POOL_PIN_NONE.
+*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_init, cl_thread_pool_pin_t
+*********/
+
+
+/****f* Component Library: Thread Pool/cl_thread_pool_submit
+* NAME
+*	cl_thread_pool_submit
+*
+* DESCRIPTION
+*	The cl_thread_pool_submit function queues a task to the workers of a
+*	thread pool.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_thread_pool_submit(
+	IN	cl_thread_pool_t* const			p_thread_pool,
+	IN	cl_thread_pool_task_t* const	p_task,
+	IN	const uint32_t					affinity );
+/*
+* PARAMETERS
+*	p_thread_pool
+*		[in] Pointer to an initialized thread pool.
+*
+*	p_task
+*		[in] Pointer to the task to run.  Its pfn_task field must be set.
+*
+*	affinity
+*		[in] Index of the worker that should run the task, modulo the
+*		number of workers, or CL_THREAD_POOL_ANY_WORKER.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	The task is queued to the tail of the inbox of the chosen worker, and
+*	a parked worker is woken if there is one.  Another worker may steal
+*	the task if the chosen one is busy, so the affinity is only a hint.
+*
+*	Inboxes are served in FIFO order.  A pool with a single worker has no
+*	one to steal from it, so tasks submitted to it with this function run
+*	in the order they were submitted.
+*
+*	Without a hint, pinned pools pick the worker of the calling processor,
+*	and other pools pick workers in turn.
+*
+*	Workers should use cl_thread_pool_spawn instead, which does not take a
+*	lock.  This function may be called at any IRQL where a spinlock may be
+*	acquired.
+*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_task_t, cl_thread_pool_spawn,
+*	CL_THREAD_POOL_ANY_WORKER
+*********/
+
+
+/*
+ * Wakes a parked worker of a pool so that it can steal newly spawned tasks.
+ */
+CL_EXPORT void CL_API
+__cl_thread_pool_wake(
+	IN	cl_thread_pool_t* const	p_thread_pool );
+
+
+/****f* Component Library: Thread Pool/cl_thread_pool_spawn
+* NAME
+*	cl_thread_pool_spawn
+*
+* DESCRIPTION
+*	The cl_thread_pool_spawn function queues a task to the worker running
+*	the calling task.
+*
+* SYNOPSIS
+*/
+CL_INLINE void CL_API
+cl_thread_pool_spawn(
+	IN	cl_thread_pool_worker_t* const	p_worker,
+	IN	cl_thread_pool_task_t* const	p_task )
+{
+	CL_ASSERT( p_worker );
+	CL_ASSERT( p_task && p_task->pfn_task );
+
+	p_task->submit_time = cl_get_time_stamp();
+	if( cl_ws_deque_push( &p_worker->deque, p_task ) != CL_SUCCESS )
+	{
+		cl_thread_pool_submit( p_worker->p_pool, p_task, p_worker->index );
+		return;
+	}
+
+	/*
+	 * Let an idle worker steal the new task.  The push publishes bottom
+	 * with a plain release store, which a later load may pass, so the idle
+	 * count is read with an interlocked add of zero.  That full barrier
+	 * keeps the push visible before the read, so that a worker parking
+	 * concurrently either sees the task or is counted as idle here.
+	 */
+	if( cl_atomic_add( &p_worker->p_pool->idle_count, 0 ) )
+		__cl_thread_pool_wake( p_worker->p_pool );
+}
+/*
+* PARAMETERS
+*	p_worker
+*		[in] Worker passed to the running task function.
+*
+*	p_task
+*		[in] Pointer to the task to run.  Its pfn_task field must be set.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Must only be called from a task function, with the worker it was
+*	given.  The task is pushed on the worker's deque without taking a
+*	lock, and the worker runs it next unless another worker steals it
+*	first.  This makes divide and conquer work cheap to split: a task can
+*	spawn its halves and idle workers will steal the larger, older pieces.
+*
+*	If the deque cannot grow, the task is submitted to the worker's inbox
+*	instead.
+*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_submit, cl_pfn_thread_pool_task_t
+*********/
+
+
+/****f* Component Library: Thread Pool/cl_thread_pool_get_stats
+* NAME
+*	cl_thread_pool_get_stats
+*
+* DESCRIPTION
+*	The cl_thread_pool_get_stats function returns the statistics of a
+*	thread pool.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_thread_pool_get_stats(
+	IN	cl_thread_pool_t* const			p_thread_pool,
+	OUT	cl_thread_pool_stats_t* const	p_stats,
+	IN	const boolean_t					reset );
+/*
+* PARAMETERS
+*	p_thread_pool
+*		[in] Pointer to an initialized thread pool.
+*
+*	p_stats
+*		[out] Receives the statistics.
+*
+*	reset
+*		[in] If TRUE, the statistics are cleared after being read.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Workers fold their counters into the pool statistics when they park,
+*	so the statistics of busy workers may lag.
+*
+* SEE ALSO
+*	Thread Pool, cl_thread_pool_stats_t
+*********/
+
+
 #ifdef __cplusplus
 }	/* extern "C" */
 #endif
@@ -124,6 +124,26 @@ typedef uint64_t		net64_t;
 	((PARENT_TYPE*)((uint8_t*)(p_member) - offsetof(PARENT_TYPE, MEMBER_NAME)))
 #endif
 
+/****d* Component Library: Data Types/CL_CACHE_LINE_SIZE
+* NAME
+*	CL_CACHE_LINE_SIZE
+*
+* DESCRIPTION
+*	The CL_CACHE_LINE_SIZE macro defines the processor cache line size
+*	assumed by components that lay out data to avoid false sharing.
+*
+* SYNOPSIS
+*/
+#ifndef CL_CACHE_LINE_SIZE
+#define CL_CACHE_LINE_SIZE	64
+#endif
+/*
+* NOTES
+*	All processors supported by the component library use 64 byte cache
+*	lines.  The value may be overridden at compile time.
+*********/
+
+
 /****d* Component Library/Parameter Keywords
 * NAME
 *	Parameter Keywords
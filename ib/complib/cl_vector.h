@@ -74,6 +74,10 @@
 *	The cl_vector_t structure should be treated as opaque and should be
 *	manipulated only through the provided functions.
 *
+*	Users that do not need pointers to elements to remain valid as the
+*	array grows should consider the Contiguous Vector, which avoids the
+*	pointer array lookup.
+*
 * SEE ALSO
 *	Structures:
 *		cl_vector_t
@@ -0,0 +1,488 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Declaration of cl_ws_deque_t, a work-stealing double ended queue.
+ *
+ * Environment:
+ *	All
+ */
+
+
+#ifndef _CL_WSDEQUE_H_
+#define _CL_WSDEQUE_H_
+
+
+#include <complib/cl_types.h>
+#include <complib/cl_atomic.h>
+
+
+/****h* Component Library/Work-Stealing Deque
+* NAME
+*	Work-Stealing Deque
+*
+* DESCRIPTION
+*	The Work-Stealing Deque is the Chase-Lev double ended queue of
+*	pointers.  A single owner thread pushes and pops items at the bottom,
+*	in last in first out order, without atomic read-modify-write
+*	operations except when taking the last item.  Any other thread may
+*	steal items from the top, in first in first out order, with a single
+*	compare and exchange.
+*
+*	The deque grows as needed.  Arrays it outgrows are kept until the
+*	deque is destroyed, since thieves may still be reading them.
+*
+*	The deque functions operate on a cl_ws_deque_t structure which should
+*	be treated as opaque and should be manipulated only through the
+*	provided functions.
+*
+* SEE ALSO
+*	Structures:
+*		cl_ws_deque_t
+*
+*	Initialization:
+*		cl_ws_deque_construct, cl_ws_deque_init, cl_ws_deque_destroy
+*
+*	Owner:
+*		cl_ws_deque_push, cl_ws_deque_pop
+*
+*	Thieves:
+*		cl_ws_deque_steal
+*
+*	Attributes:
+*		cl_ws_deque_count
+*********/
+
+
+/****d* Component Library: Work-Stealing Deque/CL_WS_DEQUE_MIN_SIZE
+* NAME
+*	CL_WS_DEQUE_MIN_SIZE
+*
+* DESCRIPTION
+*	Smallest number of items a work-stealing deque is created for.
+*
+* SYNOPSIS
+*/
+#define CL_WS_DEQUE_MIN_SIZE	64
+/*
+* SEE ALSO
+*	Work-Stealing Deque, cl_ws_deque_init
+*********/
+
+
+/* Circular array of a deque.  Its size is a power of two. */
+typedef struct _cl_ws_array
+{
+	struct _cl_ws_array		*p_retired;
+	int64_t					mask;
+	void* volatile			p_slot[1];
+
+} cl_ws_array_t;
+
+
+/****s* Component Library: Work-Stealing Deque/cl_ws_deque_t
+* NAME
+*	cl_ws_deque_t
+*
+* DESCRIPTION
+*	Work-stealing deque structure.
+*
+*	The cl_ws_deque_t structure should be treated as opaque and should
+*	be manipulated only through the provided functions.
+*
+* SYNOPSIS
+*/
+typedef struct _cl_ws_deque
+{
+	atomic64_t					top;
+	uint8_t						pad[CL_CACHE_LINE_SIZE - sizeof(atomic64_t)];
+	atomic64_t					bottom;
+	cl_ws_array_t* volatile		p_array;
+	cl_state_t					state;
+
+} cl_ws_deque_t;
+/*
+* FIELDS
+*	top
+*		Index of the oldest item, advanced by thieves and by the owner when
+*		it takes the last item.
+*
+*	pad
+*		Keeps top, written by thieves, and bottom, written by the owner, in
+*		different cache lines.
+*
+*	bottom
+*		Index one past the newest item, only written by the owner.
+*
+*	p_array
+*		Current array.  Older arrays are linked through p_retired.
+*
+*	state
+*		State of the deque.
+*
+* NOTES
+*	Indexes are 64-bit and never wrap.  Items live in
+*	p_slot[index & mask] of the array.
+*
+* SEE ALSO
+*	Work-Stealing Deque
+*********/
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/****f* Component Library: Work-Stealing Deque/cl_ws_deque_construct
+* NAME
+*	cl_ws_deque_construct
+*
+* DESCRIPTION
+*	The cl_ws_deque_construct function constructs a work-stealing deque.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_ws_deque_construct(
+	IN	cl_ws_deque_t* const	p_deque );
+/*
+* PARAMETERS
+*	p_deque
+*		[in] Pointer to a cl_ws_deque_t structure to construct.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Allows calling cl_ws_deque_destroy without first calling
+*	cl_ws_deque_init.
+*
+* SEE ALSO
+*	Work-Stealing Deque, cl_ws_deque_init, cl_ws_deque_destroy
+*********/
+
+
+/****f* Component Library: Work-Stealing Deque/cl_ws_deque_init
+* NAME
+*	cl_ws_deque_init
+*
+* DESCRIPTION
+*	The cl_ws_deque_init function initializes a work-stealing deque.
+*
+* SYNOPSIS
+*/
+CL_EXPORT cl_status_t CL_API
+cl_ws_deque_init(
+	IN	cl_ws_deque_t* const	p_deque,
+	IN	const uint32_t			min_size );
+/*
+* PARAMETERS
+*	p_deque
+*		[in] Pointer to a cl_ws_deque_t structure to initialize.
+*
+*	min_size
+*		[in] Number of items the deque holds before growing.  Rounded up
+*		to a power of two, and to at least CL_WS_DEQUE_MIN_SIZE.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the deque was initialized.
+*
+*	CL_INSUFFICIENT_MEMORY if the array could not be allocated.
+*
+* SEE ALSO
+*	Work-Stealing Deque, cl_ws_deque_construct, cl_ws_deque_destroy
+*********/
+
+
+/****f* Component Library: Work-Stealing Deque/cl_ws_deque_destroy
+* NAME
+*	cl_ws_deque_destroy
+*
+* DESCRIPTION
+*	The cl_ws_deque_destroy function frees the arrays of a work-stealing
+*	deque.
+*
+* SYNOPSIS
+*/
+CL_EXPORT void CL_API
+cl_ws_deque_destroy(
+	IN	cl_ws_deque_t* const	p_deque );
+/*
+* PARAMETERS
+*	p_deque
+*		[in] Pointer to a cl_ws_deque_t structure to destroy.
+*
+* RETURN VALUE
+*	This function does not return a value.
+*
+* NOTES
+*	Items still in the deque are not referenced anymore.  No thread may
+*	access the deque during or after this call.
+*
+* SEE ALSO
+*	Work-Stealing Deque, cl_ws_deque_construct, cl_ws_deque_init
+*********/
+
+
+/*
+ * Replaces the full array of a deque with one twice its size, copying the
+ * items between top and bottom.  Called by the owner from cl_ws_deque_push.
+ */
+CL_EXPORT cl_ws_array_t* CL_API
+__cl_ws_deque_grow(
+	IN	cl_ws_deque_t* const	p_deque,
+	IN	const int64_t			bottom,
+	IN	const int64_t			top );
+
+
+/****f* Component Library: Work-Stealing Deque/cl_ws_deque_push
+* NAME
+*	cl_ws_deque_push
+*
+* DESCRIPTION
+*	The cl_ws_deque_push function adds an item at the bottom of a deque.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_status_t CL_API
+cl_ws_deque_push(
+	IN	cl_ws_deque_t* const	p_deque,
+	IN	void* const				p_item )
+{
+	cl_ws_array_t	*p_array;
+	int64_t			bottom, top;
+
+	CL_ASSERT( p_deque->state == CL_INITIALIZED );
+	CL_ASSERT( p_item );
+
+	bottom = cl_atomic64_load_ex( &p_deque->bottom, CL_MEM_ORDER_RELAXED );
+	top = cl_atomic64_load_ex( &p_deque->top, CL_MEM_ORDER_ACQUIRE );
+	p_array = p_deque->p_array;
+	if( bottom - top > p_array->mask )
+	{
+		p_array = __cl_ws_deque_grow( p_deque, bottom, top );
+		if( !p_array )
+			return( CL_INSUFFICIENT_MEMORY );
+	}
+
+	cl_atomic_ptr_store_ex( &p_array->p_slot[bottom & p_array->mask],
+		p_item, CL_MEM_ORDER_RELAXED );
+	/* Publish the item to thieves. */
+	cl_atomic64_store_ex( &p_deque->bottom, bottom + 1, CL_MEM_ORDER_RELEASE );
+	return( CL_SUCCESS );
+}
+/*
+* PARAMETERS
+*	p_deque
+*		[in] Pointer to a cl_ws_deque_t structure.
+*
+*	p_item
+*		[in] Item to add.  Must not be NULL.
+*
+* RETURN VALUES
+*	CL_SUCCESS if the item was added.
+*
+*	CL_INSUFFICIENT_MEMORY if the deque was full and could not grow.
+*
+* NOTES
+*	Only the owner of the deque may call this function.
+*
+* SEE ALSO
+*	Work-Stealing Deque, cl_ws_deque_pop, cl_ws_deque_steal
+*********/
+
+
+/****f* Component Library: Work-Stealing Deque/cl_ws_deque_pop
+* NAME
+*	cl_ws_deque_pop
+*
+* DESCRIPTION
+*	The cl_ws_deque_pop function removes the newest item of a deque.
+*
+* SYNOPSIS
+*/
+CL_INLINE void* CL_API
+cl_ws_deque_pop(
+	IN	cl_ws_deque_t* const	p_deque )
+{
+	cl_ws_array_t	*p_array;
+	int64_t			bottom, top;
+	void			*p_item;
+
+	CL_ASSERT( p_deque->state == CL_INITIALIZED );
+
+	bottom = cl_atomic64_load_ex( &p_deque->bottom, CL_MEM_ORDER_RELAXED ) - 1;
+	p_array = p_deque->p_array;
+	/*
+	 * Reserve the item before looking at top.  The exchange is a full
+	 * barrier, so a thief either sees the new bottom or is seen here.
+	 */
+	cl_atomic64_xchg( &p_deque->bottom, bottom );
+	top = cl_atomic64_load_ex( &p_deque->top, CL_MEM_ORDER_RELAXED );
+	if( top > bottom )
+	{
+		/* The deque was empty. */
+		cl_atomic64_store_ex( &p_deque->bottom, bottom + 1,
+			CL_MEM_ORDER_RELAXED );
+		return( NULL );
+	}
+
+	p_item = p_array->p_slot[bottom & p_array->mask];
+	if( top == bottom )
+	{
+		/* Last item: take it from thieves by advancing top. */
+		if( cl_atomic64_comp_xchg( &p_deque->top, top, top + 1 ) != top )
+			p_item = NULL;
+		cl_atomic64_store_ex( &p_deque->bottom, bottom + 1,
+			CL_MEM_ORDER_RELAXED );
+	}
+	return( p_item );
+}
+/*
+* PARAMETERS
+*	p_deque
+*		[in] Pointer to a cl_ws_deque_t structure.
+*
+* RETURN VALUES
+*	Pointer to the newest item.
+*
+*	NULL if the deque is empty, or if a thief took its last item.
+*
+* NOTES
+*	Only the owner of the deque may call this function.  Taking the newest
+*	item first keeps the owner working on data that is still in its cache.
+*
+* SEE ALSO
+*	Work-Stealing Deque, cl_ws_deque_push, cl_ws_deque_steal
+*********/
+
+
+/****f* Component Library: Work-Stealing Deque/cl_ws_deque_steal
+* NAME
+*	cl_ws_deque_steal
+*
+* DESCRIPTION
+*	The cl_ws_deque_steal function removes the oldest item of a deque.
+*
+* SYNOPSIS
+*/
+CL_INLINE cl_status_t CL_API
+cl_ws_deque_steal(
+	IN	cl_ws_deque_t* const	p_deque,
+	OUT	void** const			pp_item )
+{
+	cl_ws_array_t	*p_array;
+	int64_t			bottom, top;
+	void			*p_item;
+
+	CL_ASSERT( p_deque->state == CL_INITIALIZED );
+	CL_ASSERT( pp_item );
+
+	top = cl_atomic64_load_ex( &p_deque->top, CL_MEM_ORDER_ACQUIRE );
+	bottom = cl_atomic64_load( &p_deque->bottom );
+	if( top >= bottom )
+		return( CL_NOT_FOUND );
+
+	p_array = (cl_ws_array_t*)cl_atomic_ptr_load_ex(
+		(void* volatile const*)&p_deque->p_array, CL_MEM_ORDER_ACQUIRE );
+	p_item = cl_atomic_ptr_load_ex(
+		&p_array->p_slot[top & p_array->mask], CL_MEM_ORDER_RELAXED );
+	if( cl_atomic64_comp_xchg( &p_deque->top, top, top + 1 ) != top )
+		return( CL_NOT_DONE );
+
+	*pp_item = p_item;
+	return( CL_SUCCESS );
+}
+/*
+* PARAMETERS
+*	p_deque
+*		[in] Pointer to a cl_ws_deque_t structure.
+*
+*	pp_item
+*		[out] Receives the stolen item.
+*
+* RETURN VALUES
+*	CL_SUCCESS if an item was stolen.
+*
+*	CL_NOT_FOUND if the deque is empty.
+*
+*	CL_NOT_DONE if another thread removed the oldest item first.  The
+*	deque may still hold items, and the caller may retry.
+*
+* NOTES
+*	Any thread may call this function.
+*
+* SEE ALSO
+*	Work-Stealing Deque, cl_ws_deque_push, cl_ws_deque_pop
+*********/
+
+
+/****f* Component Library: Work-Stealing Deque/cl_ws_deque_count
+* NAME
+*	cl_ws_deque_count
+*
+* DESCRIPTION
+*	The cl_ws_deque_count function returns the number of items in a deque.
+*
+* SYNOPSIS
+*/
+CL_INLINE uint32_t CL_API
+cl_ws_deque_count(
+	IN	const cl_ws_deque_t* const	p_deque )
+{
+	int64_t	count;
+
+	count = cl_atomic64_load_ex( &p_deque->bottom, CL_MEM_ORDER_RELAXED ) -
+		cl_atomic64_load_ex( &p_deque->top, CL_MEM_ORDER_RELAXED );
+	return( count > 0 ? (uint32_t)count : 0 );
+}
+/*
+* PARAMETERS
+*	p_deque
+*		[in] Pointer to a cl_ws_deque_t structure.
+*
+* RETURN VALUE
+*	Number of items in the deque.
+*
+* NOTES
+*	The count is a snapshot that may be stale as soon as it is returned,
+*	and is intended for load balancing heuristics.
+*
+* SEE ALSO
+*	Work-Stealing Deque
+*********/
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#endif /* _CL_WSDEQUE_H_ */
@@ -80,33 +80,47 @@
 #include <complib/cl_types.h>
 #include <complib/cl_debug.h>
 #include <complib/cl_memory.h>
+#include <complib/cl_arena.h>
 #include <complib/cl_atomic.h>
 #include <complib/cl_byteswap.h>
 #include <complib/cl_math.h>
 #include <complib/cl_passivelock.h>
+#include <complib/cl_rwlock.h>
 #include <complib/cl_spinlock.h>
+#include <complib/cl_lockprof.h>
 #include <complib/cl_timer.h>
 #include <complib/cl_event.h>
 #include <complib/cl_waitobj.h>
 #include <complib/cl_qlist.h>
 #include <complib/cl_list.h>
+#include <complib/cl_chunk_list.h>
 #include <complib/cl_qcomppool.h>
 #include <complib/cl_qpool.h>
 #include <complib/cl_comppool.h>
 #include <complib/cl_pool.h>
 #include <complib/cl_reqmgr.h>
 #include <complib/cl_vector.h>
+#include <complib/cl_cvector.h>
 #include <complib/cl_syscallback.h>
 #include <complib/cl_thread.h>
 #include <complib/cl_threadpool.h>
 #include <complib/cl_perf.h>
 #include <complib/cl_log.h>
 #include <complib/cl_qmap.h>
+#include <complib/cl_bqmap.h>
 #include <complib/cl_map.h>
+#include <complib/cl_qhmap.h>
+#include <complib/cl_hmap.h>
 #include <complib/cl_fleximap.h>
+#include <complib/cl_epoch.h>
+#include <complib/cl_rcufmap.h>
+#include <complib/cl_skiplist.h>
 #include <complib/cl_async_proc.h>
 #include <complib/cl_ptr_vector.h>
 #include <complib/cl_qlockpool.h>
+#include <complib/cl_magazine.h>
+#include <complib/cl_lfqpool.h>
+#include <complib/cl_wsdeque.h>
 #include <complib/cl_mutex.h>
 #include <complib/cl_obj.h>
 #include <complib/cl_ioctl.h>
@@ -81,6 +81,13 @@ cl_is_blockable( void )
 }
 
 
+CL_INLINE uint32_t
+cl_proc_current( void )
+{
+	return KeGetCurrentProcessorNumber();
+}
+
+
 #ifdef __cplusplus
 }	// extern "C"
 #endif
@@ -34,55 +34,151 @@
 
 #include <ntddk.h>
 
-typedef struct _INDEX_ENTRY
+// Entries are stored in fixed size segments reached through a directory.
+// Growing the list only reallocates the directory, so entries never move.
+#define INDEX_SEGMENT_SHIFT		8
+#define INDEX_SEGMENT_SIZE		((SIZE_T) 1 << INDEX_SEGMENT_SHIFT)
+#define INDEX_SEGMENT_MASK		(INDEX_SEGMENT_SIZE - 1)
+
+// A handle holds the index of its entry in the low INDEX_BITS bits, and
+// the generation of the entry in the remaining bits.  The generation of an
+// entry changes every time it is removed, so stale handles are rejected.
+//
+// On 32-bit builds only INDEX_GENERATION_BITS (8) bits are left for the
+// generation, so a stale handle is accepted again once its entry has been
+// reused 256 times.  Callers there must not keep handles across that many
+// removals of the same entry.  64-bit builds have 40 generation bits.
+#define INDEX_BITS				24
+#define INDEX_MASK				(((SIZE_T) 1 << INDEX_BITS) - 1)
+#define INDEX_MAX				INDEX_MASK
+#define INDEX_GENERATION_BITS	(sizeof(SIZE_T) * 8 - INDEX_BITS)
+
+C_ASSERT(INDEX_GENERATION_BITS >= 8);
+
+// Hot part of an entry, read on every handle lookup.
+typedef struct _INDEX_ITEM
+{
+	void				*pItem;
+	SIZE_T				Generation; // handle bits above INDEX_BITS
+
+}	INDEX_ITEM;
+
+// Cold part of an entry, used to link used and free entries.
+typedef struct _INDEX_LINK
 {
 	SIZE_T				Next;
 	SIZE_T				Prev;
-	void				*pItem;
 
-}	INDEX_ENTRY;
+}	INDEX_LINK;
+
+typedef struct _INDEX_SEGMENT
+{
+	INDEX_ITEM			Item[INDEX_SEGMENT_SIZE];
+	INDEX_LINK			Link[INDEX_SEGMENT_SIZE];
 
-extern INDEX_ENTRY EmptyList;
+}	INDEX_SEGMENT;
 
 // Synchronization must be provided by the caller.
 typedef struct _INDEX_LIST
 {
-	INDEX_ENTRY			*pArray;  // pArray[0] is list head of used entries
-	SIZE_T				FreeList; // singly-linked list of free INDEX_ENTRY's
+	INDEX_SEGMENT		**ppSegment; // Link[0] of segment 0 is list head of used entries
+	SIZE_T				SegmentCount;
+	SIZE_T				FreeList; // singly-linked list of free entries
 	SIZE_T				Size;
 
 }	INDEX_LIST;
 
 static void IndexListInit(INDEX_LIST *pIndexList)
 {
-	pIndexList->pArray = &EmptyList;
+	pIndexList->ppSegment = NULL;
+	pIndexList->SegmentCount = 0;
 	pIndexList->FreeList = 0;
 	pIndexList->Size = 0;
 }
 
 static void IndexListDestroy(INDEX_LIST *pIndexList)
 {
-	if (pIndexList->pArray != &EmptyList) {
-		ExFreePool(pIndexList->pArray);
+	SIZE_T i;
+
+	for (i = 0; i < pIndexList->SegmentCount; i++) {
+		ExFreePool(pIndexList->ppSegment[i]);
 	}
+	if (pIndexList->ppSegment != NULL) {
+		ExFreePool(pIndexList->ppSegment);
+	}
+}
+
+static INDEX_ITEM *IndexListItem(INDEX_LIST *pIndexList, SIZE_T Index)
+{
+	return &pIndexList->ppSegment[Index >> INDEX_SEGMENT_SHIFT]->
+		Item[Index & INDEX_SEGMENT_MASK];
+}
+
+static INDEX_LINK *IndexListLink(INDEX_LIST *pIndexList, SIZE_T Index)
+{
+	return &pIndexList->ppSegment[Index >> INDEX_SEGMENT_SHIFT]->
+		Link[Index & INDEX_SEGMENT_MASK];
 }
 
+// Returns the handle of the entry at Index.  Entry 0 is the list head,
+// whose handle is 0.
+static SIZE_T IndexListHandle(INDEX_LIST *pIndexList, SIZE_T Index)
+{
+	return Index | IndexListItem(pIndexList, Index)->Generation;
+}
+
+// Returns the handle of the new entry, or 0 if memory could not be allocated.
 SIZE_T IndexListInsertHead(INDEX_LIST *pIndexList, void *pItem);
 
-static void *IndexListAt(INDEX_LIST *pIndexList, SIZE_T Index)
+// Inserts Count items, storing their handles in pHandles.  Either all
+// items are inserted, or none are and STATUS_INSUFFICIENT_RESOURCES is
+// returned.  The list grows at most once.
+NTSTATUS IndexListInsertArray(INDEX_LIST *pIndexList, void **ppItems,
+							  SIZE_T Count, SIZE_T *pHandles);
+
+static void *IndexListAt(INDEX_LIST *pIndexList, SIZE_T Handle)
 {
-	return (Index < pIndexList->Size) ? pIndexList->pArray[Index].pItem : NULL;
+	SIZE_T		Index = Handle & INDEX_MASK;
+	INDEX_ITEM	*pEntry;
+
+	if (Index == 0 || Index >= pIndexList->Size) {
+		return NULL;
+	}
+
+	pEntry = IndexListItem(pIndexList, Index);
+	return (pEntry->Generation == (Handle & ~INDEX_MASK)) ? pEntry->pItem : NULL;
 }
 
-void *IndexListRemove(INDEX_LIST *pIndexList, SIZE_T Index);
+// Returns NULL if the handle is stale.
+void *IndexListRemove(INDEX_LIST *pIndexList, SIZE_T Handle);
+
+// Removes the entries of Count handles.  Removed items are stored in
+// ppItems if it is not NULL, with NULL for stale handles.  Returns the
+// number of entries removed.
+SIZE_T IndexListRemoveArray(INDEX_LIST *pIndexList, SIZE_T *pHandles,
+							SIZE_T Count, void **ppItems);
+
+static SIZE_T IndexListFirst(INDEX_LIST *pIndexList)
+{
+	if (pIndexList->Size == 0) {
+		return 0;
+	}
+	return IndexListHandle(pIndexList, IndexListLink(pIndexList, 0)->Next);
+}
+
+static SIZE_T IndexListNext(INDEX_LIST *pIndexList, SIZE_T Handle)
+{
+	return IndexListHandle(pIndexList,
+						   IndexListLink(pIndexList, Handle & INDEX_MASK)->Next);
+}
 
 static void *IndexListRemoveHead(INDEX_LIST *pIndexList)
 {
-	return IndexListRemove(pIndexList, pIndexList->pArray[0].Next);
+	return IndexListRemove(pIndexList, IndexListFirst(pIndexList));
 }
 
-#define IndexListForEach(pIndexList, Index)						\
-	for (Index = (pIndexList)->pArray[0].Next; Index != 0;	\
-		 Index = (pIndexList)->pArray[Index].Next)
+#define IndexListForEach(pIndexList, Handle)					\
+	for (Handle = IndexListFirst(pIndexList); Handle != 0;		\
+		 Handle = IndexListNext(pIndexList, Handle))
 
 #endif // _INDEX_LIST_H_
@@ -39,6 +39,68 @@
 #include "cl_types.h"
 
 
+/* Pointer and generation tag, exchanged as one double width value. */
+#ifdef _WIN64
+typedef __declspec(align(16)) struct _cl_tagged_ptr
+#else
+typedef __declspec(align(8)) struct _cl_tagged_ptr
+#endif
+{
+	void* volatile		p_ptr;
+	volatile uintn_t	tag;
+
+} cl_tagged_ptr_t;
+
+
+/* 64-bit integer, naturally aligned so that it can be accessed atomically. */
+typedef __declspec(align(8)) volatile int64_t	atomic64_t;
+
+
+/* 128-bit value for double width compare and exchange, where supported. */
+#ifdef _WIN64
+#define CL_ATOMIC128
+typedef __declspec(align(16)) struct _cl_atomic128
+{
+	volatile int64_t	low;
+	volatile int64_t	high;
+
+} cl_atomic128_t;
+#endif
+
+
+/* Memory ordering of the _ex atomic operations. */
+typedef enum _cl_mem_order
+{
+	CL_MEM_ORDER_RELAXED,
+	CL_MEM_ORDER_ACQUIRE,
+	CL_MEM_ORDER_RELEASE,
+	CL_MEM_ORDER_SEQ_CST
+
+} cl_mem_order_t;
+
+
+/*
+ * Interlocked operations are full barriers on x86 and x64, so only ARM
+ * selects the _acq, _rel and _nf intrinsics.  The order is expected to be
+ * a constant, letting the compiler drop the unused branches.
+ */
+#if defined( _M_ARM ) || defined( _M_ARM64 )
+#define __CL_ATOMIC_ORDERED( op, order, args ) \
+	((order) == CL_MEM_ORDER_RELAXED ? _##op##_nf args : \
+	(order) == CL_MEM_ORDER_ACQUIRE ? _##op##_acq args : \
+	(order) == CL_MEM_ORDER_RELEASE ? _##op##_rel args : op args)
+#else
+#define __CL_ATOMIC_ORDERED( op, order, args )	((void)(order), op args)
+#endif
+
+/* Orders plain loads and stores with the surrounding accesses. */
+#if defined( _M_IX86 ) || defined( _M_X64 )
+#define __cl_atomic_fence()		_ReadWriteBarrier()
+#else
+#define __cl_atomic_fence()		MemoryBarrier()
+#endif
+
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -100,6 +162,574 @@ cl_atomic_comp_xchg(
 }
 
 
+CL_INLINE int32_t CL_API
+cl_atomic_inc_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedIncrement, order,
+		((LONG*)p_value) ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_dec_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedDecrement, order,
+		((LONG*)p_value) ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_add_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			increment,
+	IN	const cl_mem_order_t	order )
+{
+	/* Return the incremented value. */
+	return( __CL_ATOMIC_ORDERED( InterlockedExchangeAdd, order,
+		((LONG*)p_value, increment) ) + increment );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_sub_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			decrement,
+	IN	const cl_mem_order_t	order )
+{
+	/* Return the decremented value. */
+	return( __CL_ATOMIC_ORDERED( InterlockedExchangeAdd, order,
+		((LONG*)p_value, -decrement) ) - decrement );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_xchg_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			new_value,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedExchange, order,
+		((LONG*)p_value, new_value) ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_comp_xchg_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			compare,
+	IN	const int32_t			new_value,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedCompareExchange, order,
+		((LONG*)p_value, new_value, compare) ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_fetch_or_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			mask,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedOr, order,
+		((LONG*)p_value, mask) ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_fetch_or(
+	IN	atomic32_t* const	p_value,
+	IN	const int32_t		mask )
+{
+	return( cl_atomic_fetch_or_ex( p_value, mask, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_fetch_and_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			mask,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedAnd, order,
+		((LONG*)p_value, mask) ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_fetch_and(
+	IN	atomic32_t* const	p_value,
+	IN	const int32_t		mask )
+{
+	return( cl_atomic_fetch_and_ex( p_value, mask, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_fetch_xor_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			mask,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedXor, order,
+		((LONG*)p_value, mask) ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_fetch_xor(
+	IN	atomic32_t* const	p_value,
+	IN	const int32_t		mask )
+{
+	return( cl_atomic_fetch_xor_ex( p_value, mask, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_load_ex(
+	IN	const atomic32_t* const	p_value,
+	IN	const cl_mem_order_t	order )
+{
+	int32_t	value;
+
+	if( order == CL_MEM_ORDER_SEQ_CST )
+		__cl_atomic_fence();
+	value = *p_value;
+	if( order != CL_MEM_ORDER_RELAXED )
+		__cl_atomic_fence();
+	return( value );
+}
+
+
+CL_INLINE int32_t CL_API
+cl_atomic_load(
+	IN	const atomic32_t* const	p_value )
+{
+	return( cl_atomic_load_ex( p_value, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE void CL_API
+cl_atomic_store_ex(
+	IN	atomic32_t* const		p_value,
+	IN	const int32_t			value,
+	IN	const cl_mem_order_t	order )
+{
+	if( order == CL_MEM_ORDER_RELAXED || order == CL_MEM_ORDER_RELEASE )
+	{
+		if( order == CL_MEM_ORDER_RELEASE )
+			__cl_atomic_fence();
+		*p_value = value;
+	}
+	else
+	{
+		InterlockedExchange( (LONG*)p_value, value );
+	}
+}
+
+
+CL_INLINE void CL_API
+cl_atomic_store(
+	IN	atomic32_t* const	p_value,
+	IN	const int32_t		value )
+{
+	cl_atomic_store_ex( p_value, value, CL_MEM_ORDER_SEQ_CST );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_inc_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedIncrement64, order,
+		((LONG64*)p_value) ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_inc(
+	IN	atomic64_t* const	p_value )
+{
+	return( cl_atomic64_inc_ex( p_value, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_dec_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedDecrement64, order,
+		((LONG64*)p_value) ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_dec(
+	IN	atomic64_t* const	p_value )
+{
+	return( cl_atomic64_dec_ex( p_value, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_add_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			increment,
+	IN	const cl_mem_order_t	order )
+{
+	/* Return the incremented value. */
+	return( __CL_ATOMIC_ORDERED( InterlockedExchangeAdd64, order,
+		((LONG64*)p_value, increment) ) + increment );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_add(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		increment )
+{
+	return( cl_atomic64_add_ex( p_value, increment, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_sub_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			decrement,
+	IN	const cl_mem_order_t	order )
+{
+	/* Return the decremented value. */
+	return( __CL_ATOMIC_ORDERED( InterlockedExchangeAdd64, order,
+		((LONG64*)p_value, -decrement) ) - decrement );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_sub(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		decrement )
+{
+	return( cl_atomic64_sub_ex( p_value, decrement, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_xchg_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			new_value,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedExchange64, order,
+		((LONG64*)p_value, new_value) ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_xchg(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		new_value )
+{
+	return( cl_atomic64_xchg_ex( p_value, new_value, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_comp_xchg_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			compare,
+	IN	const int64_t			new_value,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedCompareExchange64, order,
+		((LONG64*)p_value, new_value, compare) ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_comp_xchg(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		compare,
+	IN	const int64_t		new_value )
+{
+	return( cl_atomic64_comp_xchg_ex( p_value, compare, new_value, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_fetch_or_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			mask,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedOr64, order,
+		((LONG64*)p_value, mask) ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_fetch_or(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		mask )
+{
+	return( cl_atomic64_fetch_or_ex( p_value, mask, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_fetch_and_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			mask,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedAnd64, order,
+		((LONG64*)p_value, mask) ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_fetch_and(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		mask )
+{
+	return( cl_atomic64_fetch_and_ex( p_value, mask, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_fetch_xor_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			mask,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedXor64, order,
+		((LONG64*)p_value, mask) ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_fetch_xor(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		mask )
+{
+	return( cl_atomic64_fetch_xor_ex( p_value, mask, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_load_ex(
+	IN	const atomic64_t* const	p_value,
+	IN	const cl_mem_order_t	order )
+{
+#ifdef _WIN64
+	int64_t	value;
+
+	if( order == CL_MEM_ORDER_SEQ_CST )
+		__cl_atomic_fence();
+	value = *p_value;
+	if( order != CL_MEM_ORDER_RELAXED )
+		__cl_atomic_fence();
+	return( value );
+#else
+	/* Plain 64-bit loads may tear on 32-bit processors. */
+	UNUSED_PARAM( order );
+	return( InterlockedCompareExchange64( (LONG64*)p_value, 0, 0 ) );
+#endif
+}
+
+
+CL_INLINE int64_t CL_API
+cl_atomic64_load(
+	IN	const atomic64_t* const	p_value )
+{
+	return( cl_atomic64_load_ex( p_value, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE void CL_API
+cl_atomic64_store_ex(
+	IN	atomic64_t* const		p_value,
+	IN	const int64_t			value,
+	IN	const cl_mem_order_t	order )
+{
+#ifdef _WIN64
+	if( order == CL_MEM_ORDER_RELAXED || order == CL_MEM_ORDER_RELEASE )
+	{
+		if( order == CL_MEM_ORDER_RELEASE )
+			__cl_atomic_fence();
+		*p_value = value;
+		return;
+	}
+#else
+	UNUSED_PARAM( order );
+#endif
+	InterlockedExchange64( (LONG64*)p_value, value );
+}
+
+
+CL_INLINE void CL_API
+cl_atomic64_store(
+	IN	atomic64_t* const	p_value,
+	IN	const int64_t		value )
+{
+	cl_atomic64_store_ex( p_value, value, CL_MEM_ORDER_SEQ_CST );
+}
+
+
+CL_INLINE void* CL_API
+cl_atomic_ptr_xchg_ex(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_new,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedExchangePointer, order,
+		((PVOID*)pp_value, p_new) ) );
+}
+
+
+CL_INLINE void* CL_API
+cl_atomic_ptr_xchg(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_new )
+{
+	return( cl_atomic_ptr_xchg_ex( pp_value, p_new, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE void* CL_API
+cl_atomic_ptr_comp_xchg_ex(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_compare,
+	IN	void* const				p_new,
+	IN	const cl_mem_order_t	order )
+{
+	return( __CL_ATOMIC_ORDERED( InterlockedCompareExchangePointer, order,
+		((PVOID*)pp_value, p_new, p_compare) ) );
+}
+
+
+CL_INLINE void* CL_API
+cl_atomic_ptr_comp_xchg(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_compare,
+	IN	void* const				p_new )
+{
+	return( cl_atomic_ptr_comp_xchg_ex( pp_value, p_compare, p_new, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE void* CL_API
+cl_atomic_ptr_load_ex(
+	IN	void* volatile const* const	pp_value,
+	IN	const cl_mem_order_t		order )
+{
+	void	*p_value;
+
+	if( order == CL_MEM_ORDER_SEQ_CST )
+		__cl_atomic_fence();
+	p_value = *pp_value;
+	if( order != CL_MEM_ORDER_RELAXED )
+		__cl_atomic_fence();
+	return( p_value );
+}
+
+
+CL_INLINE void* CL_API
+cl_atomic_ptr_load(
+	IN	void* volatile const* const	pp_value )
+{
+	return( cl_atomic_ptr_load_ex( pp_value, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+
+CL_INLINE void CL_API
+cl_atomic_ptr_store_ex(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_new,
+	IN	const cl_mem_order_t	order )
+{
+	if( order == CL_MEM_ORDER_RELAXED || order == CL_MEM_ORDER_RELEASE )
+	{
+		if( order == CL_MEM_ORDER_RELEASE )
+			__cl_atomic_fence();
+		*pp_value = p_new;
+	}
+	else
+	{
+		InterlockedExchangePointer( (PVOID*)pp_value, p_new );
+	}
+}
+
+
+CL_INLINE void CL_API
+cl_atomic_ptr_store(
+	IN	void* volatile* const	pp_value,
+	IN	void* const				p_new )
+{
+	cl_atomic_ptr_store_ex( pp_value, p_new, CL_MEM_ORDER_SEQ_CST );
+}
+
+
+#ifdef CL_ATOMIC128
+
+CL_INLINE boolean_t CL_API
+cl_atomic128_comp_xchg_ex(
+	IN	cl_atomic128_t* const		p_dest,
+	IN	cl_atomic128_t* const		p_compare,
+	IN	const cl_atomic128_t* const	p_new,
+	IN	const cl_mem_order_t		order )
+{
+	return( (boolean_t)__CL_ATOMIC_ORDERED( InterlockedCompareExchange128, order,
+		((LONG64*)p_dest, p_new->high, p_new->low, (LONG64*)p_compare) ) );
+}
+
+
+CL_INLINE boolean_t CL_API
+cl_atomic128_comp_xchg(
+	IN	cl_atomic128_t* const		p_dest,
+	IN	cl_atomic128_t* const		p_compare,
+	IN	const cl_atomic128_t* const	p_new )
+{
+	return( cl_atomic128_comp_xchg_ex(
+		p_dest, p_compare, p_new, CL_MEM_ORDER_SEQ_CST ) );
+}
+
+#endif	/* CL_ATOMIC128 */
+
+
+CL_INLINE boolean_t CL_API
+cl_atomic_tagged_comp_xchg(
+	IN	cl_tagged_ptr_t* const	p_dest,
+	IN	cl_tagged_ptr_t* const	p_compare,
+	IN	void* const				p_new )
+{
+	cl_tagged_ptr_t	exchange;
+#ifndef CL_ATOMIC128
+	int64_t			initial;
+#endif
+
+	exchange.p_ptr = p_new;
+	exchange.tag = p_compare->tag + 1;
+#ifdef CL_ATOMIC128
+	return( cl_atomic128_comp_xchg( (cl_atomic128_t*)p_dest,
+		(cl_atomic128_t*)p_compare, (cl_atomic128_t*)&exchange ) );
+#else
+	initial = cl_atomic64_comp_xchg( (atomic64_t*)p_dest,
+		*(int64_t*)p_compare, *(int64_t*)&exchange );
+	if( initial == *(int64_t*)p_compare )
+		return( TRUE );
+
+	*(int64_t*)p_compare = initial;
+	return( FALSE );
+#endif
+}
+
+
 #ifdef __cplusplus
 }	// extern "C"
 #endif
@@ -0,0 +1,219 @@
+/*
+ * This software is available to you under the OpenIB.org BSD license
+ * below:
+ *
+ *     Redistribution and use in source and binary forms, with or
+ *     without modification, are permitted provided that the following
+ *     conditions are met:
+ *
+ *      - Redistributions of source code must retain the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer.
+ *
+ *      - Redistributions in binary form must reproduce the above
+ *        copyright notice, this list of conditions and the following
+ *        disclaimer in the documentation and/or other materials
+ *        provided with the distribution.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*
+ * Abstract:
+ *	Futex based lock primitives, used by the spinlock and mutex when
+ *	CL_FUTEX_LOCKS is defined.
+ *
+ * Environment:
+ *	User Mode
+ */
+
+
+#ifndef _CL_FUTEX_OSD_H_
+#define _CL_FUTEX_OSD_H_
+
+
+#include "cl_types.h"
+#include <complib/cl_atomic.h>
+
+
+/*
+ * Futex locks are selected by defining CL_FUTEX_LOCKS, and require
+ * WaitOnAddress (Windows 8 or later).
+ */
+#ifdef CL_FUTEX_LOCKS
+
+#ifndef _WIN32
+#error CL_FUTEX_LOCKS requires WaitOnAddress, only available on Windows.
+#endif
+
+
+/* Spin limits, in pause instructions, before a waiter parks. */
+#define CL_FUTEX_SPIN_MIN		16
+#define CL_FUTEX_SPIN_DEF		1024
+#define CL_FUTEX_SPIN_MAX		16384
+/* Longest pause sequence between two attempts to take the lock. */
+#define CL_FUTEX_BACKOFF_MAX	64
+
+
+/* Contention statistics of a lock, updated only on contended paths. */
+typedef struct _cl_lock_stats
+{
+	atomic32_t			contended;
+	atomic32_t			parked;
+	atomic32_t			spin_acquired;
+
+} cl_lock_stats_t;
+
+
+/*
+ * Lock word states: 0 is free, 1 is held, 2 is held with waiters that may
+ * be parked.  spin_limit adapts to the lock's hold times: it doubles when
+ * spinning acquires the lock and halves when a waiter has to park.
+ */
+typedef struct _cl_futex_lock
+{
+	atomic32_t			state;
+	volatile uint32_t	spin_limit;
+	cl_lock_stats_t		stats;
+
+} cl_futex_lock_t;
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+CL_INLINE void CL_API
+__cl_cpu_relax( void )
+{
+	YieldProcessor();
+}
+
+
+/* Waits while *p_word equals value.  Returns FALSE if wait_us elapsed. */
+CL_INLINE boolean_t CL_API
+__cl_futex_wait(
+	IN	atomic32_t* const	p_word,
+	IN	const int32_t		value,
+	IN	const uint32_t		wait_us )
+{
+	int32_t	compare = value;
+
+	if( !WaitOnAddress( (volatile VOID*)p_word, &compare, sizeof(compare),
+		(wait_us == 0xFFFFFFFF) ? INFINITE : (wait_us + 999) / 1000 ) &&
+		GetLastError() == ERROR_TIMEOUT )
+	{
+		return( FALSE );
+	}
+	return( TRUE );
+}
+
+
+CL_INLINE void CL_API
+__cl_futex_wake(
+	IN	atomic32_t* const	p_word,
+	IN	const boolean_t		wake_all )
+{
+	if( wake_all )
+		WakeByAddressAll( (PVOID)p_word );
+	else
+		WakeByAddressSingle( (PVOID)p_word );
+}
+
+
+CL_INLINE void CL_API
+__cl_futex_lock_init(
+	IN	cl_futex_lock_t* const	p_lock,
+	IN	const uint32_t			spin_limit )
+{
+	p_lock->state = 0;
+	p_lock->spin_limit = spin_limit;
+	p_lock->stats.contended = 0;
+	p_lock->stats.parked = 0;
+	p_lock->stats.spin_acquired = 0;
+}
+
+
+CL_INLINE void CL_API
+__cl_futex_lock_slow(
+	IN	cl_futex_lock_t* const	p_lock )
+{
+	uint32_t	spins, backoff, i;
+
+	cl_atomic_inc( &p_lock->stats.contended );
+
+	/* Spin with exponential backoff, reading before each attempt. */
+	for( spins = 0, backoff = 1; spins < p_lock->spin_limit; spins += backoff )
+	{
+		for( i = 0; i < backoff; i++ )
+			__cl_cpu_relax();
+
+		if( p_lock->state == 0 &&
+			cl_atomic_comp_xchg( &p_lock->state, 0, 1 ) == 0 )
+		{
+			cl_atomic_inc( &p_lock->stats.spin_acquired );
+			if( p_lock->spin_limit < CL_FUTEX_SPIN_MAX )
+				p_lock->spin_limit <<= 1;
+			return;
+		}
+
+		if( backoff < CL_FUTEX_BACKOFF_MAX )
+			backoff <<= 1;
+	}
+
+	/* The lock is held for long: spin less next time, and park. */
+	if( p_lock->spin_limit > CL_FUTEX_SPIN_MIN )
+		p_lock->spin_limit >>= 1;
+
+	cl_atomic_inc( &p_lock->stats.parked );
+	while( cl_atomic_xchg( &p_lock->state, 2 ) != 0 )
+		__cl_futex_wait( &p_lock->state, 2, 0xFFFFFFFF );
+}
+
+
+CL_INLINE void CL_API
+__cl_futex_lock_acquire(
+	IN	cl_futex_lock_t* const	p_lock )
+{
+	if( cl_atomic_comp_xchg( &p_lock->state, 0, 1 ) != 0 )
+		__cl_futex_lock_slow( p_lock );
+}
+
+
+CL_INLINE void CL_API
+__cl_futex_lock_release(
+	IN	cl_futex_lock_t* const	p_lock )
+{
+	CL_ASSERT( p_lock->state != 0 );
+
+	if( cl_atomic_xchg( &p_lock->state, 0 ) == 2 )
+		__cl_futex_wake( &p_lock->state, FALSE );
+}
+
+
+CL_INLINE void CL_API
+__cl_futex_lock_stats(
+	IN	const cl_futex_lock_t* const	p_lock,
+	OUT	cl_lock_stats_t* const			p_stats )
+{
+	*p_stats = p_lock->stats;
+}
+
+
+#ifdef __cplusplus
+}	// extern "C"
+#endif
+
+#endif	// CL_FUTEX_LOCKS
+
+#endif // _CL_FUTEX_OSD_H_
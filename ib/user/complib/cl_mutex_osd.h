@@ -44,8 +44,81 @@
 
 
 #include <complib/cl_types.h>
+#include "cl_futex_osd.h"
 
 
+#ifdef CL_FUTEX_LOCKS
+
+/*
+ * Mutexes guard longer sections than spinlocks, so waiters spin for less
+ * time before parking.  Unlike the Windows mutex, the lock is not recursive.
+ */
+typedef cl_futex_lock_t	cl_mutex_t;
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+CL_INLINE void CL_API
+cl_mutex_construct(
+	IN	cl_mutex_t* const	p_mutex )
+{
+	__cl_futex_lock_init( p_mutex, CL_FUTEX_SPIN_MIN );
+}
+
+
+CL_INLINE cl_status_t CL_API
+cl_mutex_init(
+	IN	cl_mutex_t* const	p_mutex )
+{
+	__cl_futex_lock_init( p_mutex, CL_FUTEX_SPIN_MIN );
+	return CL_SUCCESS;
+}
+
+
+CL_INLINE void CL_API
+cl_mutex_destroy(
+	IN	cl_mutex_t* const	p_mutex )
+{
+	CL_ASSERT( !p_mutex->state );
+	UNUSED_PARAM( p_mutex );
+}
+
+
+CL_INLINE void CL_API
+cl_mutex_acquire(
+	IN	cl_mutex_t* const	p_mutex )
+{
+	__cl_futex_lock_acquire( p_mutex );
+}
+
+
+CL_INLINE void CL_API
+cl_mutex_release(
+	IN	cl_mutex_t* const	p_mutex )
+{
+	__cl_futex_lock_release( p_mutex );
+}
+
+
+CL_INLINE void CL_API
+cl_mutex_get_stats(
+	IN	const cl_mutex_t* const		p_mutex,
+	OUT	cl_lock_stats_t* const		p_stats )
+{
+	__cl_futex_lock_stats( p_mutex, p_stats );
+}
+
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif
+
+#else	/* CL_FUTEX_LOCKS */
+
 typedef HANDLE	cl_mutex_t;
 
 
@@ -103,4 +176,6 @@ cl_mutex_release(
 }	/* extern "C" */
 #endif
 
+#endif	/* CL_FUTEX_LOCKS */
+
 #endif /* _CL_MUTEX_OSD_H_ */
@@ -37,8 +37,98 @@
 
 
 #include "cl_types.h"
+#include "cl_futex_osd.h"
 
 
+#ifdef CL_FUTEX_LOCKS
+
+/* Spinlock object definition, spinning adaptively before parking. */
+typedef struct _cl_spinlock
+{
+	cl_futex_lock_t		lock;
+	boolean_t			initialized;
+
+} cl_spinlock_t;
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+CL_INLINE void CL_API
+cl_spinlock_construct(
+	IN	cl_spinlock_t* const	p_spinlock )
+{
+	p_spinlock->initialized = FALSE;
+}
+
+
+CL_INLINE cl_status_t CL_API
+cl_spinlock_init(
+	IN	cl_spinlock_t* const	p_spinlock )
+{
+	CL_ASSERT( p_spinlock );
+
+	cl_spinlock_construct( p_spinlock );
+	__cl_futex_lock_init( &p_spinlock->lock, CL_FUTEX_SPIN_DEF );
+	p_spinlock->initialized = TRUE;
+	return( CL_SUCCESS );
+}
+
+
+CL_INLINE void CL_API
+cl_spinlock_destroy(
+	IN	cl_spinlock_t* const	p_spinlock )
+{
+	CL_ASSERT( p_spinlock );
+
+	if( p_spinlock->initialized )
+	{
+		CL_ASSERT( !p_spinlock->lock.state );
+		p_spinlock->initialized = FALSE;
+	}
+}
+
+
+CL_INLINE void CL_API
+cl_spinlock_acquire(
+	IN	cl_spinlock_t* const	p_spinlock )
+{
+	CL_ASSERT( p_spinlock && p_spinlock->initialized );
+
+	__cl_futex_lock_acquire( &p_spinlock->lock );
+}
+
+
+CL_INLINE void CL_API
+cl_spinlock_release(
+	IN	cl_spinlock_t* const	p_spinlock )
+{
+	CL_ASSERT( p_spinlock && p_spinlock->initialized );
+
+	__cl_futex_lock_release( &p_spinlock->lock );
+}
+
+
+CL_INLINE void CL_API
+cl_spinlock_get_stats(
+	IN	const cl_spinlock_t* const	p_spinlock,
+	OUT	cl_lock_stats_t* const		p_stats )
+{
+	CL_ASSERT( p_spinlock && p_spinlock->initialized );
+
+	__cl_futex_lock_stats( &p_spinlock->lock, p_stats );
+}
+
+
+#ifdef __cplusplus
+}	// extern "C"
+#endif
+
+#else	/* CL_FUTEX_LOCKS */
+
 /* Spinlock object definition. */
 typedef struct _cl_spinlock
 {
@@ -124,4 +214,6 @@ cl_spinlock_release(
 }	// extern "C"
 #endif
 
+#endif	/* CL_FUTEX_LOCKS */
+
 #endif // _CL_SPINLOCK_OSD_H_
@@ -83,6 +83,13 @@ cl_is_blockable( void )
 }
 
 
+CL_INLINE uint32_t CL_API
+cl_proc_current( void )
+{
+	return GetCurrentProcessorNumber();
+}
+
+
 #ifdef __cplusplus
 }	// extern "C"
 #endif